@@ -2,11 +2,13 @@
 // SAMPIC Frontend (ODB-driven; uses SampicController + FrontendEventCollector)
 // ======================================================================
 
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
 #include <chrono>
+#include <deque>
 #include <thread>
 #include <mutex>
 #include <memory>
@@ -35,7 +37,8 @@
 #include "processing/sampic_processing/config/frontend_event_collector_config.h"
 #include "processing/sampic_processing/collector/frontend_event_collector.h"
 #include "processing/sampic_processing/collector/frontend_event_buffer.h"
-#include "processing/sampic_processing/collector/banks/frontend_event_bank_data.h"
+#include "processing/sampic_processing/writer/frontend_event_file_writer.h"
+#include "processing/sampic_processing/monitor/frontend_event_monitor.h"
 
 // ======================================================================
 // Globals
@@ -49,14 +52,34 @@ INT         max_event_size_frag = 5 * max_event_size;
 INT         event_buffer_size   = 5 * max_event_size;
 
 static INT  g_frontend_index     = 0;
+static char g_bank_suffix[3]     = "00";  // two-digit frontend index appended to bank prefixes
 static char g_settings_path[256] = {0};
 static bool g_system_initialized = false;
 
 // Polling / timing
-static std::chrono::steady_clock::time_point g_last_poll_time;
-static std::chrono::microseconds             g_polling_interval(1'000'000);
-static std::chrono::steady_clock::time_point g_last_evt_ts =
-    std::chrono::steady_clock::time_point::min();
+static std::chrono::microseconds             g_poll_wait(500);
+static std::chrono::microseconds             g_max_batch_delay(10'000);
+static uint64_t                              g_min_batch_events    = 1;
+static std::chrono::microseconds             g_readout_thread_wait(10'000);
+static std::chrono::steady_clock::time_point g_batch_started;  // when poll_event first saw the unread events (epoch = none)
+static bool                                  g_midas_readout = false;  // FrontendEvents go to MIDAS this run
+static FrontendEventBuffer::ConsumerId       g_midas_consumer = 0;  // MIDAS readout's cursor in the FrontendEventBuffer
+
+// Readout: FrontendEvents fetched but not yet written (carried over when a
+// MIDAS event reaches its budget), and per-run counters
+static std::deque<std::shared_ptr<FrontendEvent>> g_readout_pending;
+struct ReadoutCounters {
+    uint64_t midas_events = 0;
+    uint64_t frontend_events = 0;
+    uint64_t bytes = 0;
+    uint64_t split_by_bytes = 0;   // MIDAS events closed at the byte budget
+    uint64_t split_by_count = 0;   // MIDAS events closed at the FrontendEvent count
+};
+static ReadoutCounters g_readout;
+
+// Held by the readout thread while it serializes, and by the run
+// transitions while they rebuild the collector and reset the readout state
+static std::mutex g_readout_mtx;
 
 // ODB-driven configs
 static FrontendConfig              g_fe_cfg;
@@ -69,6 +92,8 @@ static FrontendEventCollectorConfig g_fe_coll_cfg;
 // Core objects
 static std::unique_ptr<SampicController>       g_controller;
 static std::unique_ptr<FrontendEventCollector> g_frontend_collector;
+static std::unique_ptr<FrontendEventFileWriter> g_file_writer;  // per run, replaces MIDAS readout when enabled
+static std::unique_ptr<FrontendEventMonitor>    g_monitor;      // per run, when enabled
 
 // ======================================================================
 // Prototypes
@@ -81,6 +106,7 @@ INT pause_run(INT run_number, char *error);
 INT resume_run(INT run_number, char *error);
 INT frontend_loop(void);
 INT read_sampic_event(char *pevent, INT off);
+INT readout_thread(void *param);
 INT poll_event(INT source, INT count, BOOL test);
 INT interrupt_configure(INT cmd, INT source, POINTER_T adr);
 
@@ -111,16 +137,26 @@ EQUIPMENT equipment[] = {
 // ======================================================================
 // Utility
 // ======================================================================
-static std::string make_bank_name(const std::string& prefix, int idx2d) {
-    std::string p = prefix.empty() ? "XX" : prefix.substr(0, 2);
-    char name[8];
-    std::snprintf(name, sizeof(name), "%s%02d", p.c_str(), idx2d);
-    return std::string(name);
+/// Write the 4-character MIDAS bank name for @p prefix into @p name (5 bytes).
+static inline void make_bank_name(const std::string& prefix, char* name) {
+    const bool ok = prefix.size() >= 2;
+    name[0] = ok ? prefix[0] : 'X';
+    name[1] = ok ? prefix[1] : 'X';
+    name[2] = g_bank_suffix[0];
+    name[3] = g_bank_suffix[1];
+    name[4] = '\0';
 }
 
 // ======================================================================
 // ODB configuration
 // ======================================================================
+static void apply_polling_config() {
+    g_poll_wait           = std::chrono::microseconds(std::max(0, g_fe_cfg.poll_wait_us));
+    g_max_batch_delay     = std::chrono::microseconds(std::max(0, g_fe_cfg.max_batch_delay_us));
+    g_min_batch_events    = static_cast<uint64_t>(std::max(1, g_fe_cfg.min_batch_events));
+    g_readout_thread_wait = std::chrono::milliseconds(std::max(1, g_fe_cfg.readout_thread_wait_ms));
+}
+
 static bool initialize_all_configs_from_odb(std::string& err_out) {
     try {
         OdbManager odb;
@@ -145,7 +181,7 @@ static bool initialize_all_configs_from_odb(std::string& err_out) {
         odb.initialize(base + "/Frontend Event Collector", FrontendEventCollectorConfig{});
         g_fe_coll_cfg = odb.read<FrontendEventCollectorConfig>(base + "/Frontend Event Collector");
 
-        g_polling_interval = std::chrono::microseconds(g_fe_cfg.polling_interval_us);
+        apply_polling_config();
         return true;
     } catch (const std::exception& e) {
         err_out = e.what();
@@ -166,7 +202,7 @@ static bool read_all_configs_from_odb(std::string& err_out) {
         g_fe_coll_cfg = odb.read<FrontendEventCollectorConfig>(base + "/Frontend Event Collector");
 
         LoggerConfigurator::configure(g_logger_cfg);
-        g_polling_interval = std::chrono::microseconds(g_fe_cfg.polling_interval_us);
+        apply_polling_config();
         return true;
     } catch (const std::exception& e) {
         err_out = e.what();
@@ -199,6 +235,7 @@ INT frontend_init() {
     g_frontend_index = get_frontend_index();
     std::snprintf(g_settings_path, sizeof(g_settings_path),
                   "/Equipment/SAMPIC %02d/Settings", g_frontend_index);
+    std::snprintf(g_bank_suffix, sizeof(g_bank_suffix), "%02d", g_frontend_index % 100);
 
     OdbUtils::odbSetStatusColor(g_frontend_index, g_fe_cfg.init_color);
 
@@ -221,12 +258,21 @@ INT frontend_init() {
     spdlog::info("FrontendEventCollector created (mode={}, buffer_size={})",
                  static_cast<int>(g_fe_coll_cfg.mode), g_fe_coll_cfg.buffer_size);
 
+    if (g_fe_cfg.readout_thread) {
+        // mfe now drains the event ring buffer instead of calling poll_event
+        equipment[0].info.eq_type = (equipment[0].info.eq_type & ~EQ_POLLED) | EQ_USER;
+        create_event_rb(0);
+        ss_thread_create(readout_thread, nullptr);
+        spdlog::info("Readout thread started (EQ_USER, ring buffer 0)");
+    }
+
     g_system_initialized = true;
     OdbUtils::odbSetStatusColor(g_frontend_index, g_fe_cfg.ready_color);
     return SUCCESS;
 }
 
-INT begin_of_run(INT, char *error) {
+INT begin_of_run(INT run_number, char *error) {
+    std::lock_guard<std::mutex> readout_lock(g_readout_mtx);
     try {
         if (!g_system_initialized || !g_controller) {
             std::strcpy(error, "System not initialized");
@@ -249,8 +295,15 @@ INT begin_of_run(INT, char *error) {
             return FE_ERR_HW;
         }
 
+        // --- Consumers of the previous run's FrontendEventBuffer, which is about to be rebuilt
+        g_file_writer.reset();
+        g_monitor.reset();
+        g_midas_readout = false;
+
         // --- Apply FrontendEventCollector configs (if available)
         if (g_frontend_collector) {
+            // applySettings() above rebuilt the SAMPIC buffer; re-point the collector at it
+            g_frontend_collector->setSampicBuffer(g_controller->buffer());
             g_frontend_collector->setConfig(g_fe_coll_cfg);
             if (g_frontend_collector->applySettings() != 0) {
                 std::strcpy(error, "Failed to apply frontend collector settings");
@@ -260,6 +313,38 @@ INT begin_of_run(INT, char *error) {
             spdlog::warn("FrontendEventCollector missing during begin_of_run()");
         }
 
+        // --- Consumers of the rebuilt FrontendEventBuffer, each with its own cursor
+        if (g_frontend_collector) {
+            auto& buffer = g_frontend_collector->buffer();
+            g_midas_readout = !g_fe_cfg.file_writer.enabled || g_fe_cfg.file_writer.midas_readout;
+            if (g_midas_readout)
+                g_midas_consumer = buffer.addConsumer("midas", FrontendEventConsumerPolicy::BLOCK);
+            if (g_fe_cfg.monitor.enabled) {
+                g_monitor = std::make_unique<FrontendEventMonitor>(buffer, g_fe_cfg.monitor);
+                g_monitor->start();
+            }
+        }
+
+        // --- Local file output, instead of or alongside MIDAS readout
+        if (g_fe_cfg.file_writer.enabled && g_frontend_collector) {
+            g_file_writer = std::make_unique<FrontendEventFileWriter>(
+                g_frontend_collector->buffer(), g_fe_cfg.file_writer, g_frontend_index);
+            if (!g_file_writer->start(run_number)) {
+                g_file_writer.reset();
+                std::snprintf(error, 256, "Failed to open output file in %s",
+                              g_fe_cfg.file_writer.directory.c_str());
+                return FE_ERR_HW;
+            }
+            // A disk that falls behind backs events up in the FrontendEventBuffer;
+            // only the BLOCK overflow policy keeps them for the writer
+            if (g_fe_coll_cfg.buffer_overflow.policy != BufferOverflowPolicy::BLOCK) {
+                spdlog::warn("File writer enabled but the FrontendEventBuffer overflow policy is not BLOCK: "
+                             "events the writer has not read are dropped when the buffer fills");
+                cm_msg(MINFO, __FUNCTION__, "File writer: FrontendEventBuffer overflow policy is not BLOCK, "
+                       "events are dropped if the disk falls behind");
+            }
+        }
+
         // --- Start everything
         g_controller->startCollector();
         if (g_controller->startRun() != 0) {
@@ -271,7 +356,9 @@ INT begin_of_run(INT, char *error) {
             g_frontend_collector->start();
 
         spdlog::info("FrontendEventCollector started.");
-        g_last_evt_ts = std::chrono::steady_clock::time_point::min();
+        g_batch_started = {};
+        g_readout_pending.clear();
+        g_readout = ReadoutCounters{};
         return SUCCESS;
 
     } catch (const std::exception& e) {
@@ -288,6 +375,11 @@ INT begin_of_run(INT, char *error) {
 
 
 INT end_of_run(INT, char *error) {
+    std::lock_guard<std::mutex> readout_lock(g_readout_mtx);
+    spdlog::info("Readout: {} MIDAS events, {} FrontendEvents, {:.1f} MB "
+                 "({} closed at the byte budget, {} at the event count, {} FrontendEvents not read)",
+                 g_readout.midas_events, g_readout.frontend_events, g_readout.bytes / 1e6,
+                 g_readout.split_by_bytes, g_readout.split_by_count, g_readout_pending.size());
     try {
         if (g_frontend_collector)
             g_frontend_collector->stop();
@@ -295,6 +387,14 @@ INT end_of_run(INT, char *error) {
             g_controller->stopCollector();
             g_controller->stopRun();
         }
+        if (g_frontend_collector) {
+            for (const auto& c : g_frontend_collector->buffer().consumerStats())
+                spdlog::info("FrontendEventBuffer consumer '{}': read {}, missed {}, unread {}",
+                             c.name, c.read, c.missed, c.pending);
+        }
+        // After the collector, so the writer drains everything it built
+        g_file_writer.reset();
+        g_monitor.reset();
     } catch (const std::exception& e) {
         std::snprintf(error, 256, "Error during EOR: %s", e.what());
         return FE_ERR_HW;
@@ -308,6 +408,7 @@ INT resume_run(INT, char*) { return SUCCESS; }
 INT frontend_loop()        { return SUCCESS; }
 
 INT frontend_exit() {
+    std::lock_guard<std::mutex> readout_lock(g_readout_mtx);
     try {
         if (g_frontend_collector) g_frontend_collector->stop();
         if (g_controller) {
@@ -316,6 +417,8 @@ INT frontend_exit() {
             g_controller->cleanup();
         }
     } catch (...) {}
+    g_file_writer.reset();
+    g_monitor.reset();
     g_frontend_collector.reset();
     g_controller.reset();
     g_system_initialized = false;
@@ -326,18 +429,43 @@ INT frontend_exit() {
 // Polling
 // ======================================================================
 INT poll_event(INT, INT, BOOL test) {
-    if (!g_system_initialized || !g_frontend_collector)
-        return test ? FALSE : 0;
-
-    auto now = std::chrono::steady_clock::now();
-    if (now - g_last_poll_time < g_polling_interval)
+    // With the file writer alone, FrontendEvents go to disk, not MIDAS
+    if (!g_system_initialized || !g_frontend_collector || !g_midas_readout)
         return test ? FALSE : 0;
 
-    g_last_poll_time = now;
-    if (g_frontend_collector->buffer().hasNewSince(g_last_evt_ts))
+    // Events carried over from a full MIDAS event are ready right away
+    if (!g_readout_pending.empty())
         return TRUE;
 
-    return test ? FALSE : 0;
+    auto& buffer = g_frontend_collector->buffer();
+
+    // Calibration calls (test) must not block or touch the batch state
+    if (test)
+        return buffer.pending(g_midas_consumer) > 0 ? TRUE : FALSE;
+
+    // Idle: block briefly so readout starts as soon as an event is built
+    if (g_batch_started == std::chrono::steady_clock::time_point{}) {
+        if (!buffer.waitForConsumer(g_midas_consumer, 1, g_poll_wait))
+            return 0;
+        g_batch_started = std::chrono::steady_clock::now();
+    }
+
+    // Events are waiting: read out once the batch is full or the first one
+    // has waited max_batch_delay_us, whichever comes first
+    const auto deadline = g_batch_started + g_max_batch_delay;
+    const auto now = std::chrono::steady_clock::now();
+    bool ready = now >= deadline ||
+                 buffer.pending(g_midas_consumer) >= g_min_batch_events;
+    if (!ready) {
+        const auto left = std::chrono::duration_cast<std::chrono::microseconds>(deadline - now);
+        ready = buffer.waitForConsumer(g_midas_consumer, g_min_batch_events, std::min(g_poll_wait, left)) ||
+                std::chrono::steady_clock::now() >= deadline;
+    }
+    if (!ready)
+        return 0;
+
+    g_batch_started = {};
+    return TRUE;
 }
 
 INT interrupt_configure(INT, INT, POINTER_T) { return SUCCESS; }
@@ -345,64 +473,170 @@ INT interrupt_configure(INT, INT, POINTER_T) { return SUCCESS; }
 // ======================================================================
 // Readout (FrontendEvent → multiple banks)
 // ======================================================================
+
+// BANK32 header (bk_init32: name, type, data_size = 12 bytes) plus up to
+// 7 bytes of 8-byte alignment padding after the bank's data
+static constexpr size_t kBankOverhead = 12 + 7;
+
+/// Largest bank area (bk_size) of one event: mfe rejects events whose
+/// data_size + sizeof(EVENT_HEADER) exceeds max_event_size.
+static size_t max_event_payload() {
+    const size_t max_size = static_cast<size_t>(max_event_size);
+    return max_size > sizeof(EVENT_HEADER) ? max_size - sizeof(EVENT_HEADER) : 0;
+}
+
+/// Bytes @p fev will add to a MIDAS event.
+static size_t frontend_event_bytes(const FrontendEvent& fev) {
+    size_t n = 0;
+    for (const auto& bank : fev.banks())
+        n += bank->size() + kBankOverhead;
+    return n;
+}
+
+/// Append the banks of @p fev to the MIDAS event at @p pevent.
+static void write_frontend_event(char* pevent, const FrontendEvent& fev, size_t i) {
+    for (const auto& bank : fev.banks()) {
+        char bank_name[5];
+        make_bank_name(bank->bankPrefix(), bank_name);
+
+        const size_t used = static_cast<size_t>(bk_size(pevent)) + kBankOverhead;
+        const size_t cap = max_event_payload() > used ? max_event_payload() - used : 0;
+
+        uint8_t* pdata = nullptr;
+        bk_create(pevent, bank_name, TID_UINT8, (void**)&pdata);
+        size_t len = bank->serializeInto(pdata, cap);
+        if (len > cap) {
+            spdlog::error("read_sampic_event: bank {} ({} B) does not fit in max_event_size, "
+                          "written empty", bank_name, len);
+            len = 0;
+        }
+        bk_close(pevent, pdata + len);
+        spdlog::trace("FrontendEvent[{}] → wrote bank {} ({} bytes)", i, bank_name, len);
+    }
+}
+
 INT read_sampic_event(char *pevent, INT)
 {
-    if (!g_system_initialized || !g_frontend_collector)
+    if (!g_system_initialized || !g_frontend_collector || !g_midas_readout)
         return 0;
 
     const auto t_start = std::chrono::steady_clock::now();
 
-    auto& fbuf = g_frontend_collector->buffer();
-    const auto new_events = fbuf.getSince(g_last_evt_ts);
-    if (new_events.empty())
+    // Fetch only once the previous batch is fully written, so events stay in order
+    if (g_readout_pending.empty()) {
+        auto fetched = g_frontend_collector->buffer().consume(g_midas_consumer);
+        g_readout_pending.assign(std::make_move_iterator(fetched.begin()),
+                                 std::make_move_iterator(fetched.end()));
+    }
+    if (g_readout_pending.empty())
         return 0;
 
-    bk_init32(pevent);
+    const bool batched = g_fe_cfg.readout_packing == FrontendReadoutPacking::BATCHED;
+    const size_t hard_limit = max_event_payload();
+    const size_t byte_budget = (batched && g_fe_cfg.max_midas_event_bytes > 0)
+                                   ? std::min<size_t>(g_fe_cfg.max_midas_event_bytes, hard_limit)
+                                   : hard_limit;
+    const size_t max_events = !batched ? 1
+                              : g_fe_cfg.max_frontend_events_per_midas_event > 0
+                                  ? static_cast<size_t>(g_fe_cfg.max_frontend_events_per_midas_event)
+                                  : SIZE_MAX;
 
-    for (size_t i = 0; i < new_events.size(); ++i) {
-        const auto t_evt_start = std::chrono::steady_clock::now();
-        const auto& fev = new_events[i];
-
-        for (const auto& bank : fev->banks()) {
-            const std::string bank_name = make_bank_name(bank->bankPrefix(), g_frontend_index);
-            uint8_t* pdata = nullptr;
-            bk_create(pevent, bank_name.c_str(), TID_UINT8, (void**)&pdata);
-            uint8_t* const pstart = pdata;
-
-            if (const auto* multi = dynamic_cast<const FrontendEventBankData*>(bank.get())) {
-                for (const auto& [ptr, len] : multi->slices()) {
-                    std::memcpy(pdata, ptr, len);
-                    pdata += len;
-                }
-            } else {
-                const uint8_t* src = bank->data();
-                const size_t len = bank->size();
-                if (src && len > 0) {
-                    std::memcpy(pdata, src, len);
-                    pdata += len;
-                }
-            }
+    bk_init32(pevent);
 
-            bk_close(pevent, pdata);
-            spdlog::trace("FrontendEvent[{}] → wrote bank {} ({} bytes)",
-                          i, bank_name, static_cast<int>(pdata - pstart));
+    // Always write at least one FrontendEvent, even one larger than the budget
+    size_t n_written = 0;
+    while (!g_readout_pending.empty() && n_written < max_events) {
+        const FrontendEvent& fev = *g_readout_pending.front();
+        if (n_written > 0 &&
+            static_cast<size_t>(bk_size(pevent)) + frontend_event_bytes(fev) > byte_budget) {
+            ++g_readout.split_by_bytes;
+            break;
         }
 
-        const auto t_evt_end = std::chrono::steady_clock::now();
-        const auto dur_evt_us =
-            std::chrono::duration_cast<std::chrono::microseconds>(t_evt_end - t_evt_start).count();
-        spdlog::trace("FrontendEvent[{}] serialization took {} µs", i, dur_evt_us);
-    }
+        const auto t_evt_start = std::chrono::steady_clock::now();
+        write_frontend_event(pevent, fev, n_written);
+        const auto dur_evt_us = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - t_evt_start).count();
+        spdlog::trace("FrontendEvent[{}] serialization took {} µs", n_written, dur_evt_us);
 
-    g_last_evt_ts = new_events.back()->timestamp();
+        g_readout_pending.pop_front();
+        ++n_written;
+    }
+    if (n_written == max_events && !g_readout_pending.empty() && batched)
+        ++g_readout.split_by_count;
 
     const int total_size = bk_size(pevent);
-    const auto t_end = std::chrono::steady_clock::now();
-    const auto dur_total_us =
-        std::chrono::duration_cast<std::chrono::microseconds>(t_end - t_start).count();
+    ++g_readout.midas_events;
+    g_readout.frontend_events += n_written;
+    g_readout.bytes += static_cast<uint64_t>(total_size);
 
-    spdlog::debug("read_sampic_event: wrote {} FrontendEvents, total MIDAS size={} B ({} µs)",
-                  new_events.size(), total_size, dur_total_us);
+    const auto dur_total_us = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - t_start).count();
+    spdlog::debug("read_sampic_event: wrote {} FrontendEvents ({} carried over), total MIDAS size={} B ({} µs)",
+                  n_written, g_readout_pending.size(), total_size, dur_total_us);
 
     return total_size;
 }
+
+// ======================================================================
+// Readout thread (EQ_USER; enabled by readout_thread)
+// ======================================================================
+INT readout_thread(void *)
+{
+    const int rbh = get_event_rbh(0);
+    signal_readout_thread_active(0, TRUE);
+
+    while (is_readout_thread_enabled()) {
+        if (!readout_enabled()) {
+            ss_sleep(10);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(g_readout_mtx);
+        if (!g_system_initialized || !g_frontend_collector || !g_midas_readout) {
+            lock.unlock();
+            ss_sleep(10);
+            continue;
+        }
+
+        // Wait without g_readout_mtx so run transitions are not held up; the
+        // shared handle keeps the buffer alive if begin_of_run replaces it.
+        // Woken by the collector's push, so there is no polling latency floor
+        if (g_readout_pending.empty()) {
+            const auto buffer = g_frontend_collector->sharedBuffer();
+            const auto consumer = g_midas_consumer;
+            const auto wait = g_readout_thread_wait;
+            lock.unlock();
+            if (!buffer->waitForConsumer(consumer, 1, wait))
+                continue;
+
+            // The run may have ended or been restarted meanwhile
+            lock.lock();
+            if (!g_system_initialized || !g_frontend_collector || !g_midas_readout ||
+                (g_readout_pending.empty() &&
+                 g_frontend_collector->buffer().pending(g_midas_consumer) == 0))
+                continue;
+        }
+
+        // Space for one max_event_size event; any status but DB_SUCCESS
+        // (DB_TIMEOUT while mfe is behind, or an error) leaves wp unusable
+        void *wp = nullptr;
+        if (rb_get_wp(rbh, &wp, 0) != DB_SUCCESS) {
+            lock.unlock();
+            ss_sleep(1);
+            continue;
+        }
+
+        auto *pevent = static_cast<EVENT_HEADER*>(wp);
+        const INT size = read_sampic_event(reinterpret_cast<char*>(pevent + 1), 0);
+        if (size <= 0)
+            continue;
+
+        bm_compose_event_threadsafe(pevent, equipment[0].info.event_id, equipment[0].info.trigger_mask,
+                                    size, &equipment[0].serial_number);
+        rb_increment_wp(rbh, sizeof(EVENT_HEADER) + size);
+    }
+
+    signal_readout_thread_active(0, FALSE);
+    return 0;
+}
@@ -4,12 +4,43 @@
 #include <string>
 #include <cstddef>
 
+#include "processing/sampic_processing/config/frontend_event_file_writer_config.h"
+#include "processing/sampic_processing/config/frontend_event_monitor_config.h"
+
+// How read_sampic_event packs FrontendEvents into MIDAS events.
+enum class FrontendReadoutPacking {
+    BATCHED,    // as many FrontendEvents per MIDAS event as the budgets allow
+    PER_EVENT   // one FrontendEvent per MIDAS event
+};
+
 // Configuration for MIDAS frontend integration.
 // These parameters can be populated from the ODB.
 struct FrontendConfig {
     std::string init_color = "#8A2BE2";      // initial color code for frontend GUI
     std::string ready_color = "greenLight";  // ready status color
-    int polling_interval_us = 1000000;       // microseconds between polling for new data
+
+    // poll_event blocks on the FrontendEventBuffer for new events rather than
+    // checking it on a fixed interval, then holds readout back until a batch
+    // is worth a MIDAS event.
+    int poll_wait_us = 500;            // max time one poll_event call waits for new FrontendEvents
+    int min_batch_events = 1;          // unread FrontendEvents that start readout right away
+    int max_batch_delay_us = 10000;    // start readout anyway once the first unread event waited this long
+
+    FrontendReadoutPacking readout_packing = FrontendReadoutPacking::BATCHED;
+    int max_midas_event_bytes = 16 * 1024 * 1024;  // BATCHED: byte budget per MIDAS event (0 = max_event_size less the event header)
+    int max_frontend_events_per_midas_event = 0;   // BATCHED: FrontendEvents per MIDAS event (0 = no limit)
+
+    // Serialize on a dedicated thread straight into the mfe event ring buffer
+    // (equipment becomes EQ_USER) instead of from poll_event on the main loop.
+    // Read at frontend start; changing it needs a frontend restart.
+    bool readout_thread = false;
+    int readout_thread_wait_ms = 10;  // max wait for new FrontendEvents per thread iteration (applied at begin of run)
+
+    // Write FrontendEvents to local files instead of (or, with midas_readout, as well as) MIDAS
+    FrontendEventFileWriterConfig file_writer;
+
+    // Online rate monitor; reads the FrontendEventBuffer without slowing readout
+    FrontendEventMonitorConfig monitor;
 };
 
 #endif // SAMPIC_DAQ_INTEGRATION_MIDAS_FRONTEND_CONFIG_H
@@ -0,0 +1,56 @@
+#ifndef BUFFER_STATS_H
+#define BUFFER_STATS_H
+
+#include <atomic>
+#include <cstdint>
+
+/// Snapshot of an event buffer's occupancy and loss counters.
+struct BufferStats {
+    uint64_t pushed = 0;          ///< Events accepted into the buffer
+    uint64_t dropped_events = 0;  ///< Unread events discarded by the overflow policy
+    uint64_t dropped_hits = 0;    ///< SAMPIC hits contained in the dropped events
+    uint64_t high_water_mark = 0; ///< Largest number of unread events observed
+    uint64_t occupancy = 0;       ///< Unread events at snapshot time
+    uint64_t capacity = 0;        ///< Configured buffer capacity
+};
+
+/// Lock-free counters behind BufferStats, updated by the buffer implementations.
+class BufferStatsCounters {
+public:
+    /// Record an accepted event; @p occupancy is the unread count after the push.
+    void recordPush(uint64_t occupancy) {
+        pushed_.fetch_add(1, std::memory_order_relaxed);
+        uint64_t hw = high_water_.load(std::memory_order_relaxed);
+        while (occupancy > hw &&
+               !high_water_.compare_exchange_weak(hw, occupancy, std::memory_order_relaxed)) {}
+    }
+
+    /// Record one dropped event carrying @p hits SAMPIC hits.
+    /// @return Total number of dropped events so far.
+    uint64_t recordDrop(uint64_t hits) {
+        dropped_hits_.fetch_add(hits, std::memory_order_relaxed);
+        return dropped_events_.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    BufferStats snapshot(uint64_t occupancy, uint64_t capacity) const {
+        BufferStats s;
+        s.pushed          = pushed_.load(std::memory_order_relaxed);
+        s.dropped_events  = dropped_events_.load(std::memory_order_relaxed);
+        s.dropped_hits    = dropped_hits_.load(std::memory_order_relaxed);
+        s.high_water_mark = high_water_.load(std::memory_order_relaxed);
+        s.occupancy       = occupancy;
+        s.capacity        = capacity;
+        return s;
+    }
+
+private:
+    std::atomic<uint64_t> pushed_{0};
+    std::atomic<uint64_t> dropped_events_{0};
+    std::atomic<uint64_t> dropped_hits_{0};
+    std::atomic<uint64_t> high_water_{0};
+};
+
+/// True for drop counts worth a log line (1, 2, 4, 8, ...), to avoid flooding.
+inline bool shouldLogDrop(uint64_t n) { return (n & (n - 1)) == 0; }
+
+#endif // BUFFER_STATS_H
@@ -0,0 +1,69 @@
+#ifndef SAMPIC_EVENT_BUFFER_DEFAULT_H
+#define SAMPIC_EVENT_BUFFER_DEFAULT_H
+
+#include "integration/sampic/collector/sampic_event_buffer.h"
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+
+/**
+ * @brief Mutex-protected deque implementation of SampicEventBuffer.
+ *
+ * Supports any number of producers and consumers. Entries are released
+ * as soon as getSince() has handed them out, since each may hold a pooled
+ * EventStruct; with several readers, only the furthest one sees every event.
+ * Unread entries (newer than the furthest position handed out by
+ * getSince()) are subject to the overflow policy.
+ */
+class SampicEventBufferDefault : public SampicEventBuffer {
+public:
+    explicit SampicEventBufferDefault(size_t capacity, const BufferOverflowConfig& overflow = {});
+
+    /** @brief Add a new event, applying the overflow policy if the buffer is full. */
+    void push(const std::shared_ptr<SampicEvent>& ev) override;
+
+    std::optional<std::shared_ptr<SampicEvent>> pop() override;
+    std::optional<std::shared_ptr<SampicEvent>> latest() override;
+
+    std::vector<std::shared_ptr<SampicEvent>>
+    getSince(std::chrono::steady_clock::time_point t) override;
+    std::vector<std::shared_ptr<SampicEvent>> getSince(uint64_t& cursor) override;
+
+    bool hasNewSince(std::chrono::steady_clock::time_point t) const override;
+    bool hasNewSince(uint64_t cursor) const override;
+    bool waitForNew(std::chrono::steady_clock::time_point t,
+                    std::chrono::milliseconds timeout) override;
+    bool waitForNew(uint64_t cursor, std::chrono::milliseconds timeout) override;
+    uint64_t lastSequence() const override;
+
+    size_t size() const override;
+    bool empty() const override;
+    BufferStats stats() const override;
+
+private:
+    struct Entry {
+        std::shared_ptr<SampicEvent> ev;
+        std::chrono::steady_clock::time_point ts;
+        uint64_t seq;
+    };
+
+    /// Number of entries newer than read_seq_. Caller holds mtx_.
+    uint64_t unreadCount() const;
+
+    /// Pop the entries up to read_seq_. Caller holds mtx_.
+    void releaseRead();
+
+    /// Make room for one entry per the overflow policy. Caller holds mtx_.
+    /// @return false if the incoming event must be dropped.
+    bool makeRoom(std::unique_lock<std::mutex>& lock);
+
+    mutable std::mutex mtx_;
+    std::condition_variable cv_;
+    std::condition_variable space_cv_; ///< Signalled when the consumer reads, for BLOCK
+    std::deque<Entry> buffer_;
+    std::chrono::steady_clock::time_point last_timestamp_;
+    uint64_t last_seq_{0};
+    uint64_t read_seq_{0}; ///< Furthest sequence number handed to a consumer
+};
+
+#endif // SAMPIC_EVENT_BUFFER_DEFAULT_H
@@ -0,0 +1,100 @@
+#ifndef SAMPIC_EVENT_BUFFER_SPSC_RING_H
+#define SAMPIC_EVENT_BUFFER_SPSC_RING_H
+
+#include "integration/sampic/collector/sampic_event_buffer.h"
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <cstdint>
+
+/**
+ * @brief Bounded lock-free single-producer / single-consumer ring.
+ *
+ * The acquisition thread is the only producer and the FrontendEventCollector
+ * thread is the only consumer. When the ring is full the new event is
+ * dropped and counted (DROP_NEWEST), or with BLOCK the producer backs off
+ * until the consumer frees a slot or block_timeout_ms expires. DROP_OLDEST
+ * is not available here, since the producer may not touch the consumer's
+ * tail; it is treated as DROP_NEWEST. Head and tail
+ * indices live on separate cache lines, each side keeping a cached copy of
+ * the other's index to avoid cross-core traffic on every operation.
+ *
+ * Consumer-side semantics differ from SampicEventBufferDefault in one way:
+ * getSince() drains the ring (returning only events newer than @p t, or
+ * after the cursor), since a slot may be reused by the producer as soon as
+ * it has been read. Sequence numbers are the ring's head positions.
+ * pop(), latest(), getSince() and waitForNew() must only be called from the
+ * consumer thread.
+ */
+class SampicEventBufferSpscRing : public SampicEventBuffer {
+public:
+    /**
+     * @param capacity Requested capacity; rounded up to a power of two.
+     * @param overflow Overflow policy (DROP_OLDEST behaves as DROP_NEWEST).
+     */
+    explicit SampicEventBufferSpscRing(size_t capacity, const BufferOverflowConfig& overflow = {});
+
+    /** @brief Add a new event. Drops or waits per the policy if the ring is full. */
+    void push(const std::shared_ptr<SampicEvent>& ev) override;
+
+    std::optional<std::shared_ptr<SampicEvent>> pop() override;
+    std::optional<std::shared_ptr<SampicEvent>> latest() override;
+
+    /** @brief Drain the ring and return the events newer than @p t. */
+    std::vector<std::shared_ptr<SampicEvent>>
+    getSince(std::chrono::steady_clock::time_point t) override;
+
+    /** @brief Drain the ring and return the events after @p cursor. */
+    std::vector<std::shared_ptr<SampicEvent>> getSince(uint64_t& cursor) override;
+
+    bool hasNewSince(std::chrono::steady_clock::time_point t) const override;
+    bool hasNewSince(uint64_t cursor) const override;
+    bool waitForNew(std::chrono::steady_clock::time_point t,
+                    std::chrono::milliseconds timeout) override;
+    bool waitForNew(uint64_t cursor, std::chrono::milliseconds timeout) override;
+    uint64_t lastSequence() const override;
+
+    size_t size() const override;
+    bool empty() const override;
+    BufferStats stats() const override;
+
+private:
+    static constexpr size_t kCacheLine = 64;
+
+    struct Slot {
+        std::shared_ptr<SampicEvent> ev;
+        int64_t ts_ns{0};
+    };
+
+    static int64_t toNs(std::chrono::steady_clock::time_point t);
+
+    /// Producer side: true once a slot is free, refreshing cached_tail_.
+    bool hasSpace(uint64_t head);
+
+    /// Producer side: back off until a slot frees up or block_timeout_ms expires.
+    bool waitForSpace(uint64_t head);
+
+    /// Block the consumer until @p ready returns true or the timeout expires.
+    template <typename Pred>
+    bool waitUntil(Pred ready, std::chrono::milliseconds timeout);
+
+    std::vector<Slot> slots_;
+    size_t mask_{0};
+
+    // Producer-owned line
+    alignas(kCacheLine) std::atomic<uint64_t> head_{0};
+    uint64_t cached_tail_{0};
+
+    // Consumer-owned line
+    alignas(kCacheLine) std::atomic<uint64_t> tail_{0};
+    uint64_t cached_head_{0};
+
+    // Shared, rarely written state
+    alignas(kCacheLine) std::atomic<int64_t> last_ts_ns_;
+    std::atomic<bool> consumer_waiting_{false};
+
+    std::mutex wait_mtx_;            ///< Only taken when the consumer sleeps
+    std::condition_variable wait_cv_;
+};
+
+#endif // SAMPIC_EVENT_BUFFER_SPSC_RING_H
@@ -3,6 +3,11 @@
 
 #include "integration/sampic/collector/sampic_event_buffer.h"
 #include "integration/sampic/config/sampic_collector_config.h"
+#include "integration/sampic/collector/sampic_event_pool.h"
+#include "integration/sampic/collector/sampic_raw_recording.h"
+
+#include <memory>
+#include <chrono>
 
 extern "C" {
 #include <SAMPIC_256Ch_lib.h>
@@ -36,13 +41,68 @@ public:
      */
     virtual bool collect() = 0;
 
+    /** @brief Recycle EventStructs from @p pool instead of allocating per readout (nullptr disables). */
+    void setEventPool(std::shared_ptr<SampicEventPool> pool) { pool_ = std::move(pool); }
+
+    /**
+     * @brief Append every successful hardware read to @p recorder (nullptr disables).
+     * Only set or cleared while collect() is not running.
+     */
+    void setRawRecorder(std::shared_ptr<SampicRawRecorder> recorder) { recorder_ = std::move(recorder); }
+
 protected:
+    /** @brief EventStruct for the next readout, from the pool when one is set. */
+    std::shared_ptr<EventStruct> acquireEventStruct() {
+        return pool_ ? pool_->acquire() : std::make_shared<EventStruct>();
+    }
+
+    /**
+     * @brief Extract the SampicHitTable from a decoded event and wrap both in a SampicEvent.
+     *
+     * The extraction time is added to @p timing (decode and total). Unless
+     * keep_event_struct is set, the EventStruct is dropped here so its pool
+     * slot can be reused by the next readout.
+     */
+    std::shared_ptr<SampicEvent> makeEvent(std::shared_ptr<EventStruct> data, SampicTimingBreakdown& timing) {
+        const auto t0 = std::chrono::steady_clock::now();
+        auto hits = std::make_shared<const SampicHitTable>(*data);
+        const auto t1 = std::chrono::steady_clock::now();
+
+        const auto extract = std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0);
+        timing.decode += extract;
+        timing.total  += extract;
+
+        if (!cfg_.keep_event_struct)
+            data.reset();
+        return std::make_shared<SampicEvent>(std::move(data), std::move(hits), timing, t1);
+    }
+
+    /** @brief Record the frames of one hardware read if recording is enabled. */
+    void recordRaw(const ML_Frame* frames, int nframes,
+                   std::chrono::steady_clock::time_point read_start,
+                   std::chrono::steady_clock::time_point read_end) {
+        if (!recorder_)
+            return;
+        recorder_->write(frames, nframes,
+                         static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                             read_end.time_since_epoch()).count()),
+                         static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                             read_end - read_start).count()));
+    }
+
+    /** @brief makeEvent() and push the result into the buffer. */
+    void pushEvent(std::shared_ptr<EventStruct> data, SampicTimingBreakdown& timing) {
+        buffer_.push(makeEvent(std::move(data), timing));
+    }
+
     SampicEventBuffer& buffer_;
     CrateInfoStruct& info_;
     CrateParamStruct& params_;
     void* eventBuffer_;
     ML_Frame* mlFrames_;
     const SampicCollectorConfig& cfg_;
+    std::shared_ptr<SampicEventPool> pool_;
+    std::shared_ptr<SampicRawRecorder> recorder_;
 };
 
 #endif // SAMPIC_COLLECTOR_MODE_H
@@ -0,0 +1,130 @@
+#ifndef SAMPIC_COLLECTOR_MODE_PIPELINED_H
+#define SAMPIC_COLLECTOR_MODE_PIPELINED_H
+
+#include "integration/sampic/collector/modes/sampic_collector_mode.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @class SampicCollectorModePipelined
+ * @brief Acquisition mode that overlaps hardware reads with decoding.
+ *
+ * collect() runs on the SampicCollector thread and acts as the reader: it
+ * performs Prepare → ReadEventBuffer into the next slot of a ring of raw
+ * frame buffers and returns immediately, so the crate is drained while
+ * earlier frames are still being decoded. Each slot owns its own
+ * event buffer / ML_Frame array from SAMPIC256CH_AllocateEventMemory, so
+ * the reader reads straight into it instead of copying out of shared
+ * memory, and never waits for a decoder to finish with it. Decoding needs
+ * only the ML_Frames, which are self-contained (see SampicRawFrameHeader);
+ * the event buffer is per slot because ReadEventBuffer fills both.
+ *
+ * A pool of decoder threads runs SAMPIC256CH_DecodeEvent on filled slots
+ * in parallel. Results are published in read order: whichever decoder
+ * completes the oldest outstanding slot pushes it and every consecutive
+ * completed slot behind it. Only one decoder publishes at a time, so the
+ * SPSC_RING buffer remains safe, and it pushes without holding the mode's
+ * mutex. On destruction the decoders finish and publish every slot already
+ * read before they exit.
+ *
+ * SAMPIC256CH_DecodeEvent takes CrateInfoStruct / CrateParamStruct by
+ * non-const pointer, and the reader keeps calling Prepare/ReadEventBuffer
+ * on them. The reader therefore copies both into the slot with each read,
+ * and every decode works on its slot's copies, taken as of that read.
+ * Whether the vendor decoder keeps other internal state is not known, so
+ * num_decoders defaults to 1 (read and decode still overlap).
+ *
+ * Each SampicEvent's timing reports the reader's prepare/read time and the
+ * decoder's decode time, with the decoder index in timing.decoder.
+ * Per-thread totals are logged when the mode is destroyed.
+ */
+class SampicCollectorModePipelined : public SampicCollectorMode {
+public:
+    /**
+     * @brief Allocate the frame ring and start the decoder threads.
+     * @param buffer Output buffer for completed SampicEvents.
+     * @param info Reference to crate info structure.
+     * @param params Reference to crate parameter structure.
+     * @param eventBuffer Controller's hardware event buffer (unused; slots have their own).
+     * @param mlFrames Controller's ML_Frame array (unused; slots have their own).
+     * @param cfg Global collector configuration.
+     * @throws std::runtime_error if frame memory cannot be allocated.
+     */
+    SampicCollectorModePipelined(SampicEventBuffer& buffer,
+                                 CrateInfoStruct& info,
+                                 CrateParamStruct& params,
+                                 void* eventBuffer,
+                                 ML_Frame* mlFrames,
+                                 const SampicCollectorConfig& cfg);
+
+    /** @brief Decode and publish the slots already read, stop the decoders and release the frame ring. */
+    ~SampicCollectorModePipelined() override;
+
+    /**
+     * @brief Read one event's frames into the next free slot and queue it for decoding.
+     * @return false on acquisition error, true otherwise (including timeouts).
+     */
+    bool collect() override;
+
+private:
+    enum class SlotState { FREE, READ, DONE };
+
+    struct Slot {
+        void* event_buffer{nullptr};
+        ML_Frame* frames{nullptr};
+        int nframes{0};
+        CrateInfoStruct info{};      ///< Reader's crate state as of this read, for the decoder
+        CrateParamStruct params{};
+        uint64_t seq{0};
+        SlotState state{SlotState::FREE};
+        std::chrono::steady_clock::time_point t_start{};
+        SampicTimingBreakdown timing{};
+        std::shared_ptr<SampicEvent> result;  ///< Null if the decode failed or produced no hits
+    };
+
+    struct ThreadStats {
+        uint64_t events{0};
+        std::chrono::microseconds busy{0};
+        std::chrono::microseconds max{0};
+    };
+
+    /// Decoder thread body.
+    void decodeLoop(int index);
+
+    /// Push all consecutive DONE slots starting at next_publish_, unless another
+    /// decoder is already doing so. Caller holds mtx_ through @p lock; it is
+    /// released around the pushes.
+    void publishReady(std::unique_lock<std::mutex>& lock);
+
+    /// Direct reference to the mode-specific configuration block.
+    const SampicCollectorModePipelinedConfig& mode_cfg_;
+
+    std::vector<Slot> slots_;
+    std::vector<std::thread> decoders_;
+
+    std::mutex mtx_;
+    std::condition_variable work_cv_;   ///< Decoders: slot queued or stopping
+    std::condition_variable free_cv_;   ///< Reader: a slot was released
+    std::deque<size_t> queue_;          ///< Slots waiting for a decoder
+    uint64_t next_read_{0};             ///< Sequence of the next slot to read into
+    uint64_t next_publish_{0};          ///< Sequence of the next slot to publish
+    bool publishing_{false};            ///< A decoder is in publishReady()
+    bool stopping_{false};
+
+    // Reader-side stats (collect() thread only)
+    ThreadStats reader_stats_;
+    std::chrono::microseconds reader_stall_{0};  ///< Time spent waiting for a free slot
+
+    // Decoder-side stats, indexed by decoder; guarded by mtx_
+    std::vector<ThreadStats> decoder_stats_;
+    uint64_t decode_errors_{0};
+};
+
+#endif // SAMPIC_COLLECTOR_MODE_PIPELINED_H
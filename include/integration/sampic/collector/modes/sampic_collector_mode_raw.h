@@ -0,0 +1,54 @@
+#ifndef SAMPIC_COLLECTOR_MODE_RAW_H
+#define SAMPIC_COLLECTOR_MODE_RAW_H
+
+#include "integration/sampic/collector/modes/sampic_collector_mode.h"
+
+#include <cstdint>
+
+/**
+ * @class SampicCollectorModeRaw
+ * @brief Passthrough acquisition mode: Prepare → Read, no decoding.
+ *
+ * Each successful SAMPIC256CH_ReadEventBuffer is copied into a
+ * SampicRawFrames record and pushed as a SampicEvent without an
+ * EventStruct or hit table. The frontend writes these records as "AR"
+ * banks; SAMPIC256CH_DecodeEvent is run later by the offline decoder
+ * (scripts/tools/sampic_offline_decoder), which takes the decode cost
+ * out of the acquisition loop entirely.
+ *
+ * numHits() of the emitted events is 0, since hits are only known
+ * after decoding.
+ */
+class SampicCollectorModeRaw : public SampicCollectorMode {
+public:
+    /**
+     * @brief Construct the raw mode.
+     * @param buffer Output buffer for raw SampicEvents.
+     * @param info Reference to crate info structure.
+     * @param params Reference to crate parameter structure.
+     * @param eventBuffer Pointer to the SAMPIC hardware event buffer.
+     * @param mlFrames Pointer to the ML_Frame array filled by each read.
+     * @param cfg Global collector configuration.
+     */
+    SampicCollectorModeRaw(SampicEventBuffer& buffer,
+                           CrateInfoStruct& info,
+                           CrateParamStruct& params,
+                           void* eventBuffer,
+                           ML_Frame* mlFrames,
+                           const SampicCollectorConfig& cfg);
+
+    /**
+     * @brief Execute one acquisition cycle (Prepare→Read) and push the frames.
+     * @return true if successful, false on error.
+     */
+    bool collect() override;
+
+private:
+    /// Direct reference to the mode-specific configuration block
+    const SampicCollectorModeRawConfig& mode_cfg_;
+
+    /// Readouts pushed since construction, stored in each record header
+    uint64_t sequence_{0};
+};
+
+#endif // SAMPIC_COLLECTOR_MODE_RAW_H
@@ -0,0 +1,74 @@
+#ifndef SAMPIC_COLLECTOR_MODE_REPLAY_H
+#define SAMPIC_COLLECTOR_MODE_REPLAY_H
+
+#include "integration/sampic/collector/modes/sampic_collector_mode.h"
+#include "integration/sampic/collector/sampic_raw_recording.h"
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * @class SampicCollectorModeReplay
+ * @brief Feeds a raw recording back through SAMPIC256CH_DecodeEvent.
+ *
+ * Each collect() reads one recorded readout, decodes it with the
+ * controller's crate structures and pushes the result exactly like the
+ * default mode, so SampicEventBuffer, FrontendCollectorModeDefault and
+ * the MIDAS readout see realistic data without a crate attached (use the
+ * offline init settings mode). Readouts are released at their recorded
+ * spacing divided by speed; speed = 0 replays as fast as possible. With
+ * pacing enabled, keep the collector's sleep_time_us well below the
+ * recorded read spacing. A readout not yet due is kept for the next
+ * collect(), which waits at most kMaxPaceSleep, so stopping the collector
+ * is never held up by a long recorded gap.
+ *
+ * With loop, the replay restarts only at a clean end of file; a truncated
+ * or corrupt record ends it with an error.
+ */
+class SampicCollectorModeReplay : public SampicCollectorMode {
+public:
+    /**
+     * @brief Open the recording named in cfg.replay_mode.file.
+     * @throws std::runtime_error if the file cannot be read.
+     */
+    SampicCollectorModeReplay(SampicEventBuffer& buffer,
+                              CrateInfoStruct& info,
+                              CrateParamStruct& params,
+                              void* eventBuffer,
+                              ML_Frame* mlFrames,
+                              const SampicCollectorConfig& cfg);
+
+    /**
+     * @brief Replay the next recorded readout once it is due.
+     * @return true unless decoding fails or the recording is damaged.
+     */
+    bool collect() override;
+
+private:
+    /// Longest sleep of one collect() while waiting for a readout to be due.
+    static constexpr std::chrono::milliseconds kMaxPaceSleep{10};
+
+    /// Whether @p hdr is due at its recorded read time scaled by speed,
+    /// after sleeping towards it for at most kMaxPaceSleep.
+    bool due(const SampicRawFrameHeader& hdr);
+
+    /// Direct reference to the mode-specific configuration block
+    const SampicCollectorModeReplayConfig& mode_cfg_;
+
+    std::unique_ptr<SampicRawReader> reader_;
+    SampicRawFrameHeader hdr_{};
+    std::vector<ML_Frame> frames_;
+    bool pending_{false};                     ///< hdr_/frames_ read but not yet due
+    std::chrono::microseconds read_time_{0};  ///< File read time of the pending record
+
+    bool started_{false};
+    bool finished_{false};
+    uint64_t first_ts_ns_{0};     ///< Recorded read time of the first record in this pass
+    std::chrono::steady_clock::time_point replay_start_{};
+    uint64_t replayed_{0};
+    uint64_t passes_{0};
+};
+
+#endif // SAMPIC_COLLECTOR_MODE_REPLAY_H
@@ -0,0 +1,78 @@
+#ifndef SAMPIC_COLLECTOR_MODE_SIMULATED_H
+#define SAMPIC_COLLECTOR_MODE_SIMULATED_H
+
+#include "integration/sampic/collector/modes/sampic_collector_mode.h"
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class SampicCollectorModeSimulated
+ * @brief Hardware-free acquisition mode that synthesizes SAMPIC hits.
+ *
+ * Instead of calling SAMPIC256CH_ReadEventBuffer / SAMPIC256CH_DecodeEvent,
+ * this mode fills EventStruct / HitStruct with synthetic pulses at a
+ * configurable rate, channel occupancy, waveform length and
+ * FirstCellTimeStamp spacing. It is intended for throughput measurements
+ * of the downstream pipeline (SampicEventBuffer → FrontendEventCollector →
+ * MIDAS readout) without a crate attached.
+ *
+ * Hits are generated from a "credit" accumulated from the wall-clock time
+ * elapsed between collect() calls, so the sustained rate matches
+ * hit_rate_hz as long as the pipeline keeps up. When it does not, each
+ * call emits a full EventStruct, which exposes the pipeline's ceiling.
+ */
+class SampicCollectorModeSimulated : public SampicCollectorMode {
+public:
+    /**
+     * @brief Construct the simulated mode.
+     * @param buffer Output buffer for completed SampicEvents.
+     * @param info Reference to crate info structure (unused).
+     * @param params Reference to crate parameter structure (unused).
+     * @param eventBuffer Pointer to the SAMPIC hardware event buffer (unused).
+     * @param mlFrames Pointer to ML_Frame array (unused).
+     * @param cfg Global collector configuration.
+     */
+    SampicCollectorModeSimulated(SampicEventBuffer& buffer,
+                                 CrateInfoStruct& info,
+                                 CrateParamStruct& params,
+                                 void* eventBuffer,
+                                 ML_Frame* mlFrames,
+                                 const SampicCollectorConfig& cfg);
+
+    /**
+     * @brief Generate the hits due since the previous call and push them
+     *        as one SampicEvent.
+     * @return Always true.
+     */
+    bool collect() override;
+
+private:
+    /// Fill one HitStruct with a synthetic pulse on the given channel.
+    void fillHit(HitStruct& hit, uint16_t global_channel);
+
+    /// xorshift64* step; cheap enough to call per hit at MHz rates.
+    uint64_t nextRandom();
+
+    /// Direct reference to the mode-specific configuration block.
+    const SampicCollectorModeSimulatedConfig& mode_cfg_;
+
+    std::vector<uint16_t> active_channels_; ///< Global channel indices (board * 64 + channel)
+    std::vector<float> pulse_template_;     ///< Noise-free pulse shape, samples_per_hit long
+    std::vector<float> noise_table_;        ///< Pre-generated Gaussian noise, indexed at random offsets
+
+    int samples_per_hit_{0};
+    int max_hits_per_event_{0};
+    int peak_index_{0};
+    double spacing_ns_{0.0};
+    double sampling_period_ns_{0.0};
+
+    uint64_t rng_state_{0};
+    double hit_credit_{0.0};
+    double sim_time_ns_{0.0};
+    int hit_number_{0};
+    std::chrono::steady_clock::time_point last_collect_{};
+};
+
+#endif // SAMPIC_COLLECTOR_MODE_SIMULATED_H
@@ -4,6 +4,8 @@
 #include "integration/sampic/collector/sampic_event_buffer.h"
 #include "integration/sampic/config/sampic_collector_config.h"
 #include "integration/sampic/collector/modes/sampic_collector_mode.h"
+#include "integration/sampic/collector/sampic_event_pool.h"
+#include "integration/sampic/collector/sampic_raw_recording.h"
 
 #include <thread>
 #include <atomic>
@@ -40,9 +42,14 @@ public:
     SampicEventBuffer& buffer() { return *buffer_; }
     const SampicEventBuffer& buffer() const { return *buffer_; }
 
+    /** @brief EventStruct pool used by the mode, or nullptr if disabled. */
+    const SampicEventPool* eventPool() const { return pool_.get(); }
+
 private:
     void run();
     void buildMode(); ///< internal factory for collector mode
+    void openRecorder();  ///< start a raw recording file if raw_record_dir is set
+    void closeRecorder();
 
     SampicCollectorConfig cfg_;
     CrateInfoStruct& info_;
@@ -51,7 +58,9 @@ private:
     ML_Frame* mlFrames_;
 
     std::unique_ptr<SampicEventBuffer> buffer_;
+    std::shared_ptr<SampicEventPool> pool_;
     std::unique_ptr<SampicCollectorMode> mode_;
+    std::shared_ptr<SampicRawRecorder> recorder_;
 
     std::thread worker_;
     std::atomic<bool> running_{false};
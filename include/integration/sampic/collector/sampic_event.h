@@ -5,6 +5,9 @@
 #include <chrono>
 #include <string>
 
+#include "integration/sampic/collector/sampic_hit_table.h"
+#include "integration/sampic/collector/sampic_raw_frames.h"
+
 extern "C" {
 #include <SAMPIC_256Ch_Type.h>
 }
@@ -15,15 +18,26 @@ struct SampicTimingBreakdown {
     std::chrono::microseconds read{0};
     std::chrono::microseconds decode{0};
     std::chrono::microseconds total{0};
+
+    /// Decoder thread that decoded the event (pipelined mode); -1 if read and decode share a thread
+    int decoder = -1;
 };
 
 /// Represents a single low-level SAMPIC event with timing metadata.
+/// Carries the decoded EventStruct, a compact SampicHitTable of its hits,
+/// or both; data() is null when the EventStruct was released after extraction.
+/// In raw passthrough mode neither is set and rawFrames() holds the
+/// undecoded ML_Frame record instead.
 class SampicEvent {
 public:
     SampicEvent() = default;
     SampicEvent(std::shared_ptr<EventStruct> data,
                 const SampicTimingBreakdown& timing,
                 std::chrono::steady_clock::time_point ts);
+    SampicEvent(std::shared_ptr<EventStruct> data,
+                std::shared_ptr<const SampicHitTable> hits,
+                const SampicTimingBreakdown& timing,
+                std::chrono::steady_clock::time_point ts);
     virtual ~SampicEvent();
 
     // ------------------------------------------------------------------
@@ -35,6 +49,12 @@ public:
     void setData(const std::shared_ptr<EventStruct>& data);
     const std::shared_ptr<EventStruct>& data() const;
 
+    void setHitTable(const std::shared_ptr<const SampicHitTable>& hits);
+    const std::shared_ptr<const SampicHitTable>& hitTable() const;
+
+    void setRawFrames(const std::shared_ptr<const SampicRawFrames>& raw);
+    const std::shared_ptr<const SampicRawFrames>& rawFrames() const;
+
     void setTiming(const SampicTimingBreakdown& timing);
     const SampicTimingBreakdown& timing() const;
 
@@ -57,6 +77,8 @@ public:
 
 private:
     std::shared_ptr<EventStruct> data_;
+    std::shared_ptr<const SampicHitTable> hits_;
+    std::shared_ptr<const SampicRawFrames> raw_;
     SampicTimingBreakdown timing_{};
     std::chrono::steady_clock::time_point timestamp_{};
     bool consumed_{false};  ///< Whether this event has been consumed by a downstream processor
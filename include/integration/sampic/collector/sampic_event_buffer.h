@@ -2,61 +2,94 @@
 #define SAMPIC_EVENT_BUFFER_H
 
 #include "integration/sampic/collector/sampic_event.h"
-#include <deque>
-#include <mutex>
-#include <condition_variable>
+#include "integration/sampic/collector/buffer_stats.h"
+#include "integration/sampic/config/buffer_overflow_config.h"
 #include <optional>
 #include <chrono>
 #include <vector>
 #include <memory>
+#include <cstdint>
 
 /**
- * @brief Thread-safe buffer for holding SampicEvent objects.
+ * @brief Abstract thread-safe buffer for holding SampicEvent objects.
  *
  * Provides blocking and non-blocking access methods for both
  * producers (push) and consumers (pop, getSince, etc.).
- * Mirrors the design of FrontendEventBuffer.
+ * Mirrors the design of FrontendEventBuffer. Concrete storage strategies
+ * live in collector/buffers/ and are selected by SampicEventBufferType.
+ *
+ * Every pushed event is assigned a monotonically increasing sequence number
+ * (starting at 1). Consumers keep a cursor holding the last sequence they
+ * have seen (0 = nothing yet) and use the cursor overloads, which return
+ * exactly the events after the cursor in O(new events).
+ *
+ * When the buffer is full, push() applies the configured
+ * BufferOverflowPolicy. Events a consumer has not read yet and that are
+ * discarded are counted (events and hits) in stats().
  */
 class SampicEventBuffer {
 public:
-    explicit SampicEventBuffer(size_t capacity);
+    explicit SampicEventBuffer(size_t capacity, const BufferOverflowConfig& overflow = {})
+        : capacity_(capacity), overflow_(overflow) {}
+    virtual ~SampicEventBuffer() = default;
 
-    /** @brief Add a new event to the buffer. Drops oldest if full. */
-    void push(const std::shared_ptr<SampicEvent>& ev);
+    /** @brief Add a new event to the buffer. */
+    virtual void push(const std::shared_ptr<SampicEvent>& ev) = 0;
 
     /** @brief Retrieve and remove the oldest event, if available. */
-    std::optional<std::shared_ptr<SampicEvent>> pop();
+    virtual std::optional<std::shared_ptr<SampicEvent>> pop() = 0;
 
     /** @brief Get a reference to the most recent event without removing it. */
-    std::optional<std::shared_ptr<SampicEvent>> latest();
+    virtual std::optional<std::shared_ptr<SampicEvent>> latest() = 0;
 
     /** @brief Retrieve all events newer than a specified timestamp. */
-    std::vector<std::shared_ptr<SampicEvent>>
-    getSince(std::chrono::steady_clock::time_point t);
+    virtual std::vector<std::shared_ptr<SampicEvent>>
+    getSince(std::chrono::steady_clock::time_point t) = 0;
+
+    /**
+     * @brief Retrieve all events pushed after @p cursor and advance it.
+     * @param cursor Last sequence number seen; updated to the last returned one.
+     */
+    virtual std::vector<std::shared_ptr<SampicEvent>> getSince(uint64_t& cursor) = 0;
 
     /** @brief Check if newer events exist after a given timestamp. */
-    bool hasNewSince(std::chrono::steady_clock::time_point t) const;
+    virtual bool hasNewSince(std::chrono::steady_clock::time_point t) const = 0;
+
+    /** @brief Check if events were pushed after the given cursor. */
+    virtual bool hasNewSince(uint64_t cursor) const = 0;
 
     /**
      * @brief Wait until a new event is available or the timeout expires.
      * @return true if a new event became available before timeout.
      */
-    bool waitForNew(std::chrono::steady_clock::time_point t,
-                    std::chrono::milliseconds timeout);
+    virtual bool waitForNew(std::chrono::steady_clock::time_point t,
+                            std::chrono::milliseconds timeout) = 0;
+
+    /** @brief Wait until an event is pushed after @p cursor or the timeout expires. */
+    virtual bool waitForNew(uint64_t cursor, std::chrono::milliseconds timeout) = 0;
+
+    /** @brief Sequence number of the most recently pushed event (0 if none). */
+    virtual uint64_t lastSequence() const = 0;
 
     /** @brief Number of events currently in the buffer. */
-    size_t size() const;
+    virtual size_t size() const = 0;
 
     /** @brief Return true if the buffer is empty. */
-    bool empty() const;
+    virtual bool empty() const = 0;
+
+    /** @brief Maximum number of events the buffer holds. */
+    size_t capacity() const { return capacity_; }
+
+    /** @brief Overflow handling applied by push(). */
+    const BufferOverflowConfig& overflowConfig() const { return overflow_; }
+
+    /** @brief Snapshot of the push / drop counters and current occupancy. */
+    virtual BufferStats stats() const = 0;
 
-private:
+protected:
     size_t capacity_;
-    mutable std::mutex mtx_;
-    std::condition_variable cv_;
-    std::deque<std::pair<std::shared_ptr<SampicEvent>,
-                         std::chrono::steady_clock::time_point>> buffer_;
-    std::chrono::steady_clock::time_point last_timestamp_;
+    BufferOverflowConfig overflow_;
+    BufferStatsCounters counters_;
 };
 
 #endif // SAMPIC_EVENT_BUFFER_H
@@ -0,0 +1,74 @@
+#ifndef SAMPIC_EVENT_POOL_H
+#define SAMPIC_EVENT_POOL_H
+
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+
+extern "C" {
+#include <SAMPIC_256Ch_Type.h>
+}
+
+/// Snapshot of SampicEventPool usage.
+struct SampicEventPoolStats {
+    size_t capacity = 0;          ///< Preallocated EventStruct slots
+    size_t available = 0;         ///< Slots currently free
+    size_t in_use_high_water = 0; ///< Largest number of slots out at once
+    uint64_t acquired = 0;        ///< Successful acquisitions from the pool
+    uint64_t exhausted = 0;       ///< Acquisitions served by a heap fallback because the pool was empty
+};
+
+/**
+ * @brief Preallocated, recycling pool of EventStruct slots.
+ *
+ * EventStruct is a large fixed-size array of HitStruct; allocating and
+ * zeroing one per readout costs page faults on the acquisition thread.
+ * The pool allocates (and touches) all slots once at construction.
+ * acquire() hands out a slot wrapped in a shared_ptr whose deleter puts it
+ * back, so a slot returns automatically when the last SampicEvent /
+ * FrontendEventBankData reference drops, on whichever thread that happens.
+ *
+ * Slots are not cleared between uses; SAMPIC256CH_DecodeEvent (or the
+ * simulated mode) overwrites NbOfHitsInEvent and the hits it reports.
+ *
+ * Must be owned by a std::shared_ptr: outstanding slots keep the pool
+ * alive, so it may outlive the SampicCollector that created it.
+ */
+class SampicEventPool : public std::enable_shared_from_this<SampicEventPool> {
+public:
+    /** @param capacity Number of EventStruct slots to preallocate. */
+    explicit SampicEventPool(size_t capacity);
+
+    SampicEventPool(const SampicEventPool&) = delete;
+    SampicEventPool& operator=(const SampicEventPool&) = delete;
+
+    /**
+     * @brief Take a free slot, or heap-allocate one if the pool is empty.
+     * @return EventStruct that is recycled (or freed) when the last reference drops.
+     */
+    std::shared_ptr<EventStruct> acquire();
+
+    /** @brief Number of preallocated slots. */
+    size_t capacity() const { return capacity_; }
+
+    /** @brief Snapshot of pool usage counters. */
+    SampicEventPoolStats stats() const;
+
+private:
+    void release(EventStruct* slot);
+
+    size_t capacity_;
+    std::unique_ptr<EventStruct[]> storage_;
+
+    mutable std::mutex mtx_;
+    std::vector<EventStruct*> free_;
+    size_t in_use_high_water_{0};
+
+    std::atomic<uint64_t> acquired_{0};
+    std::atomic<uint64_t> exhausted_{0};
+};
+
+#endif // SAMPIC_EVENT_POOL_H
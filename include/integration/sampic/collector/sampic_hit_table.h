@@ -0,0 +1,82 @@
+#ifndef SAMPIC_HIT_TABLE_H
+#define SAMPIC_HIT_TABLE_H
+
+#include <vector>
+#include <span>
+#include <cstdint>
+#include <cstddef>
+
+extern "C" {
+#include <SAMPIC_256Ch_Type.h>
+}
+
+/**
+ * @class SampicHitTable
+ * @brief Compact structure-of-arrays copy of the hits of one decoded EventStruct.
+ *
+ * Filled right after SAMPIC256CH_DecodeEvent so the (very large) EventStruct
+ * can be recycled immediately. Each column holds one value per hit; row i
+ * corresponds to EventStruct::Hit[i]. Only the first samples_per_hit
+ * CorrectedDataSamples of each hit are kept, where samples_per_hit is the
+ * largest DataSize in the event (i.e. the crate's samples_to_read); shorter
+ * hits are zero-padded and keep their own length in dataSize().
+ */
+class SampicHitTable {
+public:
+    SampicHitTable() = default;
+
+    /**
+     * @brief Build a table from the hits of a decoded event.
+     * @param ev Decoded event; NbOfHitsInEvent rows are copied.
+     */
+    explicit SampicHitTable(const EventStruct& ev);
+
+    /** @brief Number of hits (rows). */
+    size_t size() const { return first_cell_time_.size(); }
+    bool empty() const { return first_cell_time_.empty(); }
+
+    /** @brief Stride of the sample column (samples stored per hit). */
+    size_t samplesPerHit() const { return samples_per_hit_; }
+
+    // ------------------------------------------------------------------
+    // Columns
+    // ------------------------------------------------------------------
+    std::span<const double>   firstCellTimeStamps() const { return first_cell_time_; }
+    std::span<const double>   timeInstants() const { return time_instant_; }
+    std::span<const float>    baselines() const { return baseline_; }
+    std::span<const float>    amplitudes() const { return amplitude_; }
+    std::span<const float>    peaks() const { return peak_; }
+    std::span<const int32_t>  hitNumbers() const { return hit_number_; }
+    std::span<const uint16_t> boards() const { return board_; }
+    std::span<const uint16_t> chips() const { return chip_; }
+    std::span<const uint16_t> channels() const { return channel_; }
+    std::span<const uint16_t> dataSizes() const { return data_size_; }
+
+    /** @brief All corrected samples, row-major with samplesPerHit() stride. */
+    std::span<const float> samples() const { return samples_; }
+
+    /** @brief Corrected samples of one hit (samplesPerHit() values). */
+    std::span<const float> samples(size_t row) const {
+        return {samples_.data() + row * samples_per_hit_, samples_per_hit_};
+    }
+
+    /** @brief Approximate heap footprint in bytes. */
+    size_t memoryBytes() const;
+
+private:
+    size_t samples_per_hit_{0};
+
+    std::vector<double>   first_cell_time_;
+    std::vector<double>   time_instant_;
+    std::vector<float>    baseline_;
+    std::vector<float>    amplitude_;
+    std::vector<float>    peak_;
+    std::vector<int32_t>  hit_number_;
+    std::vector<uint16_t> board_;
+    std::vector<uint16_t> chip_;
+    std::vector<uint16_t> channel_;
+    std::vector<uint16_t> data_size_;
+    std::vector<float>    samples_;
+};
+
+#endif // SAMPIC_HIT_TABLE_H
@@ -0,0 +1,117 @@
+#ifndef SAMPIC_RAW_FRAMES_H
+#define SAMPIC_RAW_FRAMES_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+
+extern "C" {
+#include <SAMPIC_256Ch_Type.h>
+}
+
+static_assert(std::is_trivially_copyable_v<ML_Frame>,
+              "ML_Frame must be trivially copyable to be stored as raw bytes");
+
+/// Magic number at the start of every raw frame record ("SPRF", little endian).
+constexpr uint32_t kSampicRawFrameMagic = 0x46525053;
+
+/// Current raw frame record version.
+constexpr uint16_t kSampicRawFrameVersion = 1;
+
+#pragma pack(push, 1)
+/**
+ * @brief Header of one raw frame record: the ML_Frame blocks returned by a
+ *        single SAMPIC256CH_ReadEventBuffer call, stored byte-for-byte.
+ *
+ * The same record is used for the "AR" MIDAS bank and for raw recording
+ * files. ML_Frame must be a self-contained POD in the vendor library in
+ * use: each frame carries its bytes (FrameSize + Data), not a pointer into
+ * the event buffer from SAMPIC256CH_AllocateEventMemory, which is not
+ * recorded. The RAW, PIPELINED and REPLAY modes and the offline decoder
+ * all rely on this. frame_struct_size lets readers reject records written
+ * against a different library build.
+ */
+struct SampicRawFrameHeader {
+    /** kSampicRawFrameMagic. */
+    uint32_t magic;
+
+    /** kSampicRawFrameVersion. */
+    uint16_t version;
+
+    /** sizeof(ML_Frame) in the writer. */
+    uint16_t frame_struct_size;
+
+    /** Number of ML_Frame entries following the header. */
+    uint32_t nframes;
+
+    /** Time spent in SAMPIC256CH_ReadEventBuffer (µs), 0 if unknown. */
+    uint32_t read_us;
+
+    /** Readout counter since the collector mode was built. */
+    uint64_t sequence;
+
+    /** steady_clock time (ns since epoch) when the read completed. */
+    uint64_t read_timestamp_ns;
+};
+#pragma pack(pop)
+
+/**
+ * @class SampicRawFrames
+ * @brief One raw frame record (header + ML_Frame array) in a contiguous buffer.
+ */
+class SampicRawFrames {
+public:
+    /**
+     * @brief Copy @p nframes frames into a new record.
+     * @param frames Frames filled by SAMPIC256CH_ReadEventBuffer.
+     * @param nframes Number of valid frames.
+     * @param sequence Readout counter.
+     * @param read_timestamp_ns Time the read completed.
+     * @param read_us Duration of the read.
+     */
+    SampicRawFrames(const ML_Frame* frames, int nframes,
+                    uint64_t sequence, uint64_t read_timestamp_ns, uint32_t read_us = 0);
+
+    /** @brief Adopt an already serialized record (validated with unpack() by the caller). */
+    explicit SampicRawFrames(std::vector<uint8_t> bytes);
+
+    const uint8_t* data() const { return bytes_.data(); }
+    size_t size() const { return bytes_.size(); }
+
+    /** @brief Copy of the record header. */
+    SampicRawFrameHeader header() const;
+
+    /** @brief Fill a record header for @p nframes frames. */
+    static SampicRawFrameHeader makeHeader(uint32_t nframes, uint64_t sequence,
+                                           uint64_t read_timestamp_ns, uint32_t read_us);
+
+    /** @brief True if @p hdr has the expected magic, version and sizeof(ML_Frame). */
+    static bool isValid(const SampicRawFrameHeader& hdr) {
+        return hdr.magic == kSampicRawFrameMagic &&
+               hdr.version == kSampicRawFrameVersion &&
+               hdr.frame_struct_size == sizeof(ML_Frame);
+    }
+
+    /**
+     * @brief Validate a serialized record and copy its frames out.
+     * @param data Start of the record.
+     * @param size Bytes available (may exceed the record).
+     * @param hdr Filled with the record header.
+     * @param frames Resized and filled with the record's frames (aligned copy).
+     * @return Record size in bytes, or 0 if the record is malformed or
+     *         was written with a different sizeof(ML_Frame).
+     */
+    static size_t unpack(const uint8_t* data, size_t size,
+                         SampicRawFrameHeader& hdr, std::vector<ML_Frame>& frames);
+
+    /** @brief Bytes occupied by a record with @p nframes frames. */
+    static size_t recordSize(uint32_t nframes) {
+        return sizeof(SampicRawFrameHeader) + static_cast<size_t>(nframes) * sizeof(ML_Frame);
+    }
+
+private:
+    std::vector<uint8_t> bytes_;
+};
+
+#endif // SAMPIC_RAW_FRAMES_H
@@ -0,0 +1,124 @@
+#ifndef SAMPIC_RAW_RECORDING_H
+#define SAMPIC_RAW_RECORDING_H
+
+#include "integration/sampic/collector/sampic_raw_frames.h"
+
+#include <cstdio>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/// Magic number at the start of a raw recording file ("SPRS", little endian).
+constexpr uint32_t kSampicRawFileMagic = 0x53525053;
+
+/// Current raw recording file version.
+constexpr uint16_t kSampicRawFileVersion = 1;
+
+#pragma pack(push, 1)
+/**
+ * @brief Header of a raw recording file. It is followed by SampicRawFrames
+ *        records (SampicRawFrameHeader + ML_Frame[nframes]) until EOF.
+ */
+struct SampicRawFileHeader {
+    /** kSampicRawFileMagic. */
+    uint32_t magic;
+
+    /** kSampicRawFileVersion. */
+    uint16_t version;
+
+    /** sizeof(ML_Frame) in the writer. */
+    uint16_t frame_struct_size;
+
+    /** Wall-clock time the file was opened (ns since Unix epoch). */
+    uint64_t created_unix_ns;
+};
+#pragma pack(pop)
+
+/**
+ * @class SampicRawRecorder
+ * @brief Appends every SAMPIC256CH_ReadEventBuffer result to a raw recording file.
+ *
+ * Called from the acquisition thread right after a successful read, so
+ * write() only copies into a large stdio buffer; the kernel write happens
+ * when the buffer fills. Thread-safe.
+ */
+class SampicRawRecorder {
+public:
+    /**
+     * @brief Create (truncate) @p path and write the file header.
+     * @throws std::runtime_error if the file cannot be opened.
+     */
+    explicit SampicRawRecorder(const std::string& path);
+    ~SampicRawRecorder();
+
+    SampicRawRecorder(const SampicRawRecorder&) = delete;
+    SampicRawRecorder& operator=(const SampicRawRecorder&) = delete;
+
+    /**
+     * @brief Append one readout.
+     * @param frames Frames filled by SAMPIC256CH_ReadEventBuffer.
+     * @param nframes Number of valid frames.
+     * @param read_timestamp_ns steady_clock time the read completed.
+     * @param read_us Duration of the read.
+     */
+    void write(const ML_Frame* frames, int nframes, uint64_t read_timestamp_ns, uint32_t read_us);
+
+    /** @brief Flush and close; further writes are ignored. */
+    void close();
+
+    const std::string& path() const { return path_; }
+    uint64_t records() const;
+    uint64_t bytes() const;
+
+private:
+    std::string path_;
+    std::FILE* file_{nullptr};
+    std::vector<char> stdio_buffer_;
+    uint64_t records_{0};
+    uint64_t bytes_{0};
+    bool write_failed_{false};
+    mutable std::mutex mtx_;
+};
+
+/**
+ * @class SampicRawReader
+ * @brief Sequential reader for files written by SampicRawRecorder.
+ */
+class SampicRawReader {
+public:
+    /**
+     * @brief Open @p path and validate the file header.
+     * @throws std::runtime_error if the file cannot be opened or was written
+     *         with a different format or sizeof(ML_Frame).
+     */
+    explicit SampicRawReader(const std::string& path);
+    ~SampicRawReader();
+
+    SampicRawReader(const SampicRawReader&) = delete;
+    SampicRawReader& operator=(const SampicRawReader&) = delete;
+
+    /**
+     * @brief Read the next record.
+     * @param hdr Filled with the record header.
+     * @param frames Resized and filled with the record's frames.
+     * @return false at end of file or on a truncated/corrupt record.
+     */
+    bool next(SampicRawFrameHeader& hdr, std::vector<ML_Frame>& frames);
+
+    /** @brief True if the last next() failed at a clean end of file, after a complete record. */
+    bool atEnd() const { return at_end_; }
+
+    /** @brief Seek back to the first record. */
+    void rewind();
+
+    const SampicRawFileHeader& fileHeader() const { return file_header_; }
+
+private:
+    std::string path_;
+    std::FILE* file_{nullptr};
+    SampicRawFileHeader file_header_{};
+    bool at_end_{false};
+};
+
+#endif // SAMPIC_RAW_RECORDING_H
@@ -0,0 +1,23 @@
+#ifndef BUFFER_OVERFLOW_CONFIG_H
+#define BUFFER_OVERFLOW_CONFIG_H
+
+#include <cstdint>
+
+/// What an event buffer does when a producer pushes into a full buffer.
+/// Events the consumer has already read are always evicted first and are
+/// never counted as dropped.
+enum class BufferOverflowPolicy {
+    DROP_OLDEST,  ///< Evict the oldest unread event
+    DROP_NEWEST,  ///< Reject the incoming event
+    BLOCK         ///< Block the producer until space frees up or the timeout expires (then drop newest)
+};
+
+/// Overflow handling for SampicEventBuffer / FrontendEventBuffer.
+struct BufferOverflowConfig {
+    BufferOverflowPolicy policy = BufferOverflowPolicy::DROP_OLDEST;
+
+    /// Maximum time a producer blocks under BLOCK before dropping (ms)
+    uint32_t block_timeout_ms = 100;
+};
+
+#endif // BUFFER_OVERFLOW_CONFIG_H
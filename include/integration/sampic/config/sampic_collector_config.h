@@ -3,11 +3,23 @@
 
 #include <string>
 #include <cstddef>
+#include <cstdint>
+#include "integration/sampic/config/buffer_overflow_config.h"
 
 /// Collector mode selector
 enum class SampicCollectorModeType {
     DEFAULT,
-    EXAMPLE
+    EXAMPLE,
+    SIMULATED,
+    PIPELINED,
+    RAW,
+    REPLAY
+};
+
+/// SampicEventBuffer storage strategy
+enum class SampicEventBufferType {
+    DEFAULT,    ///< Mutex-protected deque, any number of producers/consumers
+    SPSC_RING   ///< Lock-free single-producer/single-consumer ring, producer never blocks
 };
 
 /// Default collector mode configuration
@@ -29,6 +41,73 @@ struct SampicCollectorModeExampleConfig {
     int soft_trigger_retry_sleep_us = 100;
 };
 
+/// Simulated collector mode configuration (synthetic hits, no hardware access)
+struct SampicCollectorModeSimulatedConfig {
+    /// Mean total hit rate across all active channels (Hz)
+    double hit_rate_hz = 1'000'000.0;
+
+    /// Fraction of the crate's channels (boards x 64) that produce hits, in (0, 1]
+    double channel_occupancy = 1.0;
+
+    /// Number of front-end boards to emulate (64 channels each)
+    int num_boards = 4;
+
+    /// Number of samples written per hit (DataSize)
+    int samples_per_hit = 64;
+
+    /// Emulated sampling frequency, used for TimeInstant (MHz)
+    int sampling_frequency_mhz = 6400;
+
+    /// FirstCellTimeStamp spacing between consecutive hits (ns); 0 derives it from hit_rate_hz
+    double timestamp_spacing_ns = 0.0;
+
+    /// Upper bound on hits per EventStruct; 0 uses the full EventStruct capacity
+    int max_hits_per_event = 0;
+
+    /// Synthetic pulse shape (volts) and white noise RMS (volts)
+    double baseline_v = 0.0;
+    double amplitude_v = 0.3;
+    double noise_rms_v = 0.002;
+
+    /// Seed for the pseudo-random channel / noise generator
+    uint32_t seed = 12345;
+};
+
+/// Pipelined collector mode configuration (reader thread + decoder pool)
+struct SampicCollectorModePipelinedConfig {
+    /// Number of decoder threads calling SAMPIC256CH_DecodeEvent in parallel.
+    /// Raise only once the vendor decoder is known to be reentrant.
+    int num_decoders = 1;
+
+    /// Raw frame buffers in flight between the reader and the decoders (>= num_decoders + 1)
+    int ring_slots = 8;
+
+    /// Same soft-trigger retry parameters as the default mode
+    int soft_trigger_prepare_interval = 100;
+    int soft_trigger_max_loops = 10000;
+    int soft_trigger_retry_sleep_us = 100;
+};
+
+/// Raw passthrough collector mode configuration (read only, decoding deferred offline)
+struct SampicCollectorModeRawConfig {
+    /// Same soft-trigger retry parameters as the default mode
+    int soft_trigger_prepare_interval = 100;
+    int soft_trigger_max_loops = 10000;
+    int soft_trigger_retry_sleep_us = 100;
+};
+
+/// Replay collector mode configuration (decodes a raw recording, no hardware access)
+struct SampicCollectorModeReplayConfig {
+    /// Raw recording file written via raw_record_dir
+    std::string file = "";
+
+    /// Playback speed relative to the recorded read times; 0 replays as fast as possible
+    double speed = 1.0;
+
+    /// Restart from the first record at end of file
+    bool loop = false;
+};
+
 /// Top-level collector configuration
 struct SampicCollectorConfig {
     // --- Mode selection ---
@@ -38,12 +117,40 @@ struct SampicCollectorConfig {
     /// Number of events the buffer can hold
     size_t buffer_size = 128;
 
+    /// Buffer implementation between the collector and FrontendEventCollector threads
+    SampicEventBufferType buffer_type = SampicEventBufferType::DEFAULT;
+
+    /// What push() does when the buffer is full of unread events
+    BufferOverflowConfig buffer_overflow;
+
+    /// Recycle EventStructs through a preallocated pool instead of allocating per readout
+    bool use_event_pool = true;
+
+    /// EventStruct slots in the pool; 0 sizes it to buffer_size + 8.
+    /// A slot stays in use until its SampicEvent has been read from the
+    /// SampicEventBuffer and, with keep_event_struct, until every group and
+    /// FrontendEvent built from it has been read out as well. When all are
+    /// taken, readout falls back to heap allocation (counted as exhausted).
+    size_t event_pool_size = 0;
+
+    /// Keep the decoded EventStruct attached to each SampicEvent after its
+    /// SampicHitTable is extracted. Required by the HITSTRUCT data bank format;
+    /// disable to recycle the EventStruct immediately (COMPACT format only).
+    bool keep_event_struct = true;
+
+    /// Directory for raw recordings of every hardware read (one file per run); empty disables
+    std::string raw_record_dir = "";
+
     /// Microseconds between collector polls
     int sleep_time_us = 1'000'000;
 
     // --- Per-mode configurations ---
     SampicCollectorModeDefaultConfig default_mode;
     SampicCollectorModeExampleConfig example_mode;
+    SampicCollectorModeSimulatedConfig simulated_mode;
+    SampicCollectorModePipelinedConfig pipelined_mode;
+    SampicCollectorModeRawConfig raw_mode;
+    SampicCollectorModeReplayConfig replay_mode;
 };
 
 #endif // SAMPIC_COLLECTOR_CONFIG_H
@@ -4,14 +4,18 @@
 #include <string>
 
 /// Modes for initialization and applying settings
+/// OFFLINE skips every crate access (no connection, no hardware settings,
+/// no start/stop run) so simulated or replayed collectors can run without a crate.
 enum class SampicInitSettingsModeType {
     DEFAULT,
-    EXAMPLE
+    EXAMPLE,
+    OFFLINE
 };
 
 enum class SampicApplySettingsModeType {
     DEFAULT,
-    EXAMPLE
+    EXAMPLE,
+    OFFLINE
 };
 
 /// Configuration for the default initialization mode
@@ -0,0 +1,14 @@
+#ifndef SAMPIC_APPLY_SETTINGS_MODE_OFFLINE_H
+#define SAMPIC_APPLY_SETTINGS_MODE_OFFLINE_H
+
+#include "integration/sampic/controller/apply_settings_modes/sampic_apply_settings_mode.h"
+
+/// Offline mode: no hardware to configure, settings are only logged
+class SampicApplySettingsModeOffline : public SampicApplySettingsMode {
+public:
+    using SampicApplySettingsMode::SampicApplySettingsMode;
+
+    void apply() override;
+};
+
+#endif // SAMPIC_APPLY_SETTINGS_MODE_OFFLINE_H
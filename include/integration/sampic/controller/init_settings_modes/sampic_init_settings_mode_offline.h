@@ -0,0 +1,14 @@
+#ifndef SAMPIC_INIT_SETTINGS_MODE_OFFLINE_H
+#define SAMPIC_INIT_SETTINGS_MODE_OFFLINE_H
+
+#include "integration/sampic/controller/init_settings_modes/sampic_init_settings_mode.h"
+
+/// Offline mode: prepares parameters, calibration and event memory without
+/// opening a crate connection (for simulated / replayed acquisition).
+class SampicInitSettingsModeOffline : public SampicInitSettingsMode {
+public:
+    using SampicInitSettingsMode::SampicInitSettingsMode;
+    int initialize() override;
+};
+
+#endif // SAMPIC_INIT_SETTINGS_MODE_OFFLINE_H
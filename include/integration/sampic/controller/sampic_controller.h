@@ -56,6 +56,9 @@ public:
     const SampicEventBuffer& buffer() const;
 
 private:
+    /// True when the controller runs without a crate (OFFLINE init mode).
+    bool offline() const { return ctrl_cfg_.init_mode == SampicInitSettingsModeType::OFFLINE; }
+
     // Configs
     SampicSystemSettings   settings_;
     SampicControllerConfig ctrl_cfg_;
@@ -0,0 +1,130 @@
+#ifndef COMPRESSED_SAMPLE_CODEC_H
+#define COMPRESSED_SAMPLE_CODEC_H
+
+#include "processing/sampic_processing/collector/banks/packed_sample_codec.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <vector>
+
+/**
+ * @class CompressedSampleCodec
+ * @brief Layout and coding of compressed PACKED data banks.
+ *
+ * Each hit's ADC codes are stored as residuals from a per-hit reference
+ * (the rounded mean of the first kReferenceSamples codes, i.e. the
+ * baseline), zigzag mapped so small negative and positive residuals both
+ * become small numbers, then either bit-packed or written as LEB128
+ * varints. Bit-packed residuals go in blocks of kBlock samples: one width
+ * byte per block, then each block at its own width (0 stores nothing),
+ * so quiet baseline blocks stay narrow. The whole body may additionally
+ * be LZ4 compressed. Bank layout (little endian, no padding):
+ *
+ *   BankHeader
+ *   body (LZ4 block if flags & kLz4, else as is), body_size bytes once decoded:
+ *     for each hit:
+ *       HitHeader
+ *       uint8_t residuals[payload_bytes]
+ *
+ * HitHeader::base.bits is the widest block of a bit-packed hit and 0 for
+ * varint hits. Decoding needs only this header and the MIDAS LZ4 library
+ * when kLz4 is set.
+ */
+class CompressedSampleCodec {
+public:
+    static constexpr uint8_t kVarint = 0x1;  ///< Residuals are varints
+    static constexpr uint8_t kLz4    = 0x2;  ///< Body is one LZ4 block
+
+    static constexpr uint8_t kVersion = 1;
+    static constexpr size_t kReferenceSamples = 8;
+    static constexpr size_t kBlock = 8;  ///< Residuals per bit-packed block
+
+#pragma pack(push, 1)
+    struct BankHeader {
+        /** Number of hits in the bank. */
+        uint32_t n_hits;
+
+        /** sizeof(HitHeader), so readers can skip fields added later. */
+        uint16_t hit_header_size;
+
+        /** Layout version, currently 1. */
+        uint8_t version;
+
+        /** kVarint / kLz4. */
+        uint8_t flags;
+
+        /** Size of the body once LZ4 decoded. */
+        uint32_t body_size;
+    };
+
+    struct HitHeader {
+        PackedSampleCodec::HitHeader base;
+        int32_t  reference;      ///< Subtracted from every code
+        uint16_t payload_bytes;  ///< Residual bytes following this header
+        uint16_t reserved;
+    };
+#pragma pack(pop)
+
+    /** @brief True if LZ4 was available at build time. */
+    static bool lz4Available();
+
+    /**
+     * @brief Append one hit to @p body.
+     * @param hh Hit header with the scalars filled; the coding fields are set here.
+     */
+    static void appendHit(std::vector<uint8_t>& body, HitHeader hh,
+                          const int32_t* codes, size_t n, bool varint);
+
+    /**
+     * @brief Build the bank from the hits appended to @p body.
+     *
+     * With @p lz4 the body is LZ4 compressed, unless LZ4 is unavailable or
+     * does not make it smaller, in which case kLz4 is left unset.
+     */
+    static std::vector<uint8_t> finish(uint32_t n_hits, const std::vector<uint8_t>& body,
+                                       bool varint, bool lz4);
+
+    /** @brief Read the header and the decoded body; false if the bank is unusable. */
+    static bool readBody(const uint8_t* data, size_t size, BankHeader& bh, std::vector<uint8_t>& body);
+
+    /** @brief Decode @p n residuals of one hit into ADC codes. */
+    static bool decodeHit(const HitHeader& hh, const uint8_t* payload, size_t n,
+                          bool varint, int32_t* out);
+
+    /**
+     * @brief Decode a compressed bank, calling
+     *        @p fn(const HitHeader&, std::span<const int32_t> codes) for each hit.
+     * @return False if the bank is truncated or has an unknown layout.
+     */
+    template <typename Fn>
+    static bool forEachHit(const uint8_t* data, size_t size, Fn&& fn) {
+        BankHeader bh;
+        std::vector<uint8_t> body;
+        if (!readBody(data, size, bh, body))
+            return false;
+
+        std::vector<int32_t> codes;
+        size_t pos = 0;
+        for (uint32_t i = 0; i < bh.n_hits; ++i) {
+            HitHeader hh;
+            if (body.size() - pos < bh.hit_header_size)
+                return false;
+            std::memcpy(&hh, body.data() + pos, sizeof(hh));
+            pos += bh.hit_header_size;
+
+            if (body.size() - pos < hh.payload_bytes)
+                return false;
+            codes.resize(hh.base.data_size);
+            if (!decodeHit(hh, body.data() + pos, codes.size(), bh.flags & kVarint, codes.data()))
+                return false;
+            pos += hh.payload_bytes;
+
+            fn(hh, std::span<const int32_t>(codes));
+        }
+        return true;
+    }
+};
+
+#endif // COMPRESSED_SAMPLE_CODEC_H
@@ -4,6 +4,7 @@
 #include <string>
 #include <cstdint>
 #include <cstddef>
+#include <cstring>
 #include <stdexcept>
 
 /// Base class for all frontend event banks.
@@ -31,6 +32,16 @@ public:
     /// Total size in bytes of serialized data
     virtual size_t size() const = 0;
 
+    /// Copy the serialized bank to @p dst if it fits in @p cap bytes.
+    /// Returns size(); nothing is written when that exceeds @p cap.
+    /// Banks that are not one contiguous region override this.
+    virtual size_t serializeInto(uint8_t* dst, size_t cap) const {
+        const size_t len = size();
+        if (len > 0 && len <= cap)
+            std::memcpy(dst, data(), len);
+        return len;
+    }
+
 protected:
     std::string bank_prefix_{"XX"};
 };
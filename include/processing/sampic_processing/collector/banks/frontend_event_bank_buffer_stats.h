@@ -0,0 +1,78 @@
+#ifndef FRONTEND_EVENT_BANK_BUFFER_STATS_H
+#define FRONTEND_EVENT_BANK_BUFFER_STATS_H
+
+#include "processing/sampic_processing/collector/banks/frontend_event_bank.h"
+#include "integration/sampic/collector/buffer_stats.h"
+#include <cstdint>
+
+/**
+ * @class FrontendEventBankBufferStats
+ * @brief Publishes occupancy and loss counters of both event buffers.
+ *
+ * Attached next to the collector timing bank once per collection cycle,
+ * so dropped events and hits show up in the data stream rather than only
+ * in the log. Counters are cumulative since the buffers were (re)built at
+ * begin of run.
+ */
+class FrontendEventBankBufferStats : public FrontendEventBank {
+public:
+#pragma pack(push, 1)
+    /** Counters of one buffer. */
+    struct BufferRecord {
+        /** Events accepted into the buffer. */
+        uint64_t pushed;
+
+        /** Unread events discarded by the overflow policy. */
+        uint64_t dropped_events;
+
+        /** SAMPIC hits contained in the dropped events. */
+        uint64_t dropped_hits;
+
+        /** Largest number of unread events observed. */
+        uint32_t high_water_mark;
+
+        /** Unread events at the time of the snapshot. */
+        uint32_t occupancy;
+
+        /** Configured buffer capacity. */
+        uint32_t capacity;
+    };
+
+    struct Record {
+        /** Timestamp (ns since epoch) when the counters were sampled. */
+        uint64_t timestamp_ns;
+
+        /** SampicEventBuffer (acquisition → frontend collector). */
+        BufferRecord sampic;
+
+        /** FrontendEventBuffer (frontend collector → MIDAS readout). */
+        BufferRecord frontend;
+    };
+#pragma pack(pop)
+
+    /**
+     * @brief Construct the bank from buffer snapshots.
+     * @param timestamp_ns Sampling time (ns since epoch).
+     * @param sampic Snapshot of the SampicEventBuffer.
+     * @param frontend Snapshot of the FrontendEventBuffer.
+     * @param prefix Optional bank prefix (default "AB").
+     */
+    FrontendEventBankBufferStats(uint64_t timestamp_ns,
+                                 const BufferStats& sampic,
+                                 const BufferStats& frontend,
+                                 const std::string& prefix = "AB");
+
+    /** @brief Return pointer to serialized record data. */
+    const uint8_t* data() const override;
+
+    /** @brief Return byte size of serialized record. */
+    size_t size() const override;
+
+    /** @brief Access the filled record. */
+    const Record& record() const { return record_; }
+
+private:
+    Record record_{};
+};
+
+#endif // FRONTEND_EVENT_BANK_BUFFER_STATS_H
@@ -0,0 +1,71 @@
+#ifndef FRONTEND_EVENT_BANK_COMPACT_DATA_H
+#define FRONTEND_EVENT_BANK_COMPACT_DATA_H
+
+#include "processing/sampic_processing/collector/banks/frontend_event_bank.h"
+#include "integration/sampic/collector/sampic_event.h"
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+/**
+ * @class FrontendEventBankCompactData
+ * @brief Waveform/scalar bank serialized from SampicHitTable rows.
+ *
+ * Unlike FrontendEventBankData, this bank copies the selected rows into its
+ * own buffer, so it does not keep any SampicEvent or EventStruct alive.
+ * Layout (little endian, all columns naturally aligned):
+ *
+ *   Header
+ *   double   first_cell_timestamp[n_hits]
+ *   double   time_instant[n_hits]
+ *   float    baseline[n_hits]
+ *   float    amplitude[n_hits]
+ *   float    peak[n_hits]
+ *   int32_t  hit_number[n_hits]
+ *   uint16_t board[n_hits]
+ *   uint16_t chip[n_hits]
+ *   uint16_t channel[n_hits]
+ *   uint16_t data_size[n_hits]
+ *   float    samples[n_hits * samples_per_hit]   (zero-padded past data_size)
+ */
+class FrontendEventBankCompactData : public FrontendEventBank {
+public:
+#pragma pack(push, 1)
+    struct Header {
+        /** Number of hits in the bank. */
+        uint32_t n_hits;
+
+        /** Stride of the samples column. */
+        uint16_t samples_per_hit;
+
+        /** Layout version, currently 1. */
+        uint16_t version;
+    };
+#pragma pack(pop)
+
+    static constexpr uint16_t kVersion = 1;
+
+    /// One hit: row @p row of parents[@p parent]->hitTable().
+    struct HitRef {
+        uint32_t parent;
+        uint32_t row;
+    };
+
+    /**
+     * @brief Serialize the referenced hits.
+     * @param parents SampicEvents owning the hit tables (only read during construction).
+     * @param hits Rows to serialize, in output order.
+     * @param prefix Optional bank prefix (default "AD").
+     */
+    FrontendEventBankCompactData(const std::vector<std::shared_ptr<SampicEvent>>& parents,
+                                 const std::vector<HitRef>& hits,
+                                 const std::string& prefix = "AD");
+
+    const uint8_t* data() const override { return buffer_.data(); }
+    size_t size() const override { return buffer_.size(); }
+
+private:
+    std::vector<uint8_t> buffer_;
+};
+
+#endif // FRONTEND_EVENT_BANK_COMPACT_DATA_H
@@ -0,0 +1,58 @@
+#ifndef FRONTEND_EVENT_BANK_COMPRESSED_DATA_H
+#define FRONTEND_EVENT_BANK_COMPRESSED_DATA_H
+
+#include "processing/sampic_processing/collector/banks/frontend_event_bank.h"
+#include "processing/sampic_processing/collector/banks/compressed_sample_codec.h"
+#include "processing/sampic_processing/config/frontend_event_collector_config.h"
+#include "integration/sampic/collector/sampic_event.h"
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+#include <cstdint>
+
+/**
+ * @class FrontendEventBankCompressedData
+ * @brief Compressed PACKED data bank, filled asynchronously.
+ *
+ * Created empty by FrontendEventBuilder and completed by a
+ * FrontendBankCompressor worker, so the builder does not wait for the
+ * compression. data() and size() block until the payload is there; by the
+ * time the MIDAS readout serializes the event it normally is. Layout:
+ * see CompressedSampleCodec.
+ */
+class FrontendEventBankCompressedData : public FrontendEventBank {
+public:
+    explicit FrontendEventBankCompressedData(const std::string& prefix = "AD");
+
+    /**
+     * @brief Encode the given hits into a bank payload.
+     * @param hits HitStructs to serialize, in output order.
+     * @param min_bits Width the uncompressed PACKED bank would use (for @p packed_size).
+     * @param cfg Compression level and residual coding.
+     * @param packed_size Set to the size the PACKED bank would have had.
+     */
+    static std::vector<uint8_t> encode(const std::vector<const HitStruct*>& hits,
+                                       unsigned min_bits,
+                                       const FrontendCompressionConfig& cfg,
+                                       size_t& packed_size);
+
+    /** @brief Publish the payload and wake any waiting reader. */
+    void complete(std::vector<uint8_t>&& payload);
+
+    /** @brief True once complete() has been called. */
+    bool ready() const;
+
+    const uint8_t* data() const override;
+    size_t size() const override;
+    size_t serializeInto(uint8_t* dst, size_t cap) const override;
+
+private:
+    void waitReady() const;
+
+    mutable std::mutex mtx_;
+    mutable std::condition_variable cv_;
+    bool ready_{false};
+    std::vector<uint8_t> buffer_;
+};
+
+#endif // FRONTEND_EVENT_BANK_COMPRESSED_DATA_H
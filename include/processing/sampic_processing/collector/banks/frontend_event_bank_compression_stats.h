@@ -0,0 +1,78 @@
+#ifndef FRONTEND_EVENT_BANK_COMPRESSION_STATS_H
+#define FRONTEND_EVENT_BANK_COMPRESSION_STATS_H
+
+#include "processing/sampic_processing/collector/banks/frontend_event_bank.h"
+#include "processing/sampic_processing/collector/frontend_bank_compressor.h"
+#include <cstdint>
+
+/**
+ * @class FrontendEventBankCompressionStats
+ * @brief Publishes the data bank compression counters.
+ *
+ * Attached next to the collector timing bank when compression is enabled.
+ * Counters are cumulative since the collector mode was built at begin of
+ * run; the ratio is against the uncompressed PACKED layout.
+ */
+class FrontendEventBankCompressionStats : public FrontendEventBank {
+public:
+#pragma pack(push, 1)
+    struct Record {
+        /** Timestamp (ns since epoch) when the counters were sampled. */
+        uint64_t timestamp_ns;
+
+        /** Banks compressed, and their hits. */
+        uint64_t banks;
+        uint64_t hits;
+
+        /** Bytes as uncompressed PACKED banks, and as written. */
+        uint64_t bytes_in;
+        uint64_t bytes_out;
+
+        /** Worker time spent compressing (ns, summed over workers). */
+        uint64_t busy_ns;
+
+        /** Banks written uncompressed because the queue was full. */
+        uint64_t bypassed;
+
+        /** Banks queued or in progress when sampled. */
+        uint32_t pending;
+
+        /** Compression threads. */
+        uint32_t workers;
+
+        /** bytes_in / bytes_out. */
+        float ratio;
+
+        /** bytes_in per second of worker time (MB/s per core). */
+        float mb_per_s_per_core;
+    };
+#pragma pack(pop)
+
+    /**
+     * @brief Construct the bank from the compressor counters.
+     * @param timestamp_ns Sampling time (ns since epoch).
+     * @param stats Compressor counters.
+     * @param pending Banks waiting or in progress.
+     * @param workers Number of compression threads.
+     * @param prefix Optional bank prefix (default "AZ").
+     */
+    FrontendEventBankCompressionStats(uint64_t timestamp_ns,
+                                      const FrontendCompressionStats& stats,
+                                      uint32_t pending,
+                                      uint32_t workers,
+                                      const std::string& prefix = "AZ");
+
+    /** @brief Return pointer to serialized record data. */
+    const uint8_t* data() const override;
+
+    /** @brief Return byte size of serialized record. */
+    size_t size() const override;
+
+    /** @brief Access the filled record. */
+    const Record& record() const { return record_; }
+
+private:
+    Record record_{};
+};
+
+#endif // FRONTEND_EVENT_BANK_COMPRESSION_STATS_H
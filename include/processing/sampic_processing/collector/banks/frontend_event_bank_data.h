@@ -5,22 +5,31 @@
 #include "integration/sampic/collector/sampic_event.h"
 #include <vector>
 #include <memory>
+#include <memory_resource>
+#include <span>
 
 /// Bank representing waveform and scalar data from multiple SampicEvents.
 /// Keeps SampicEvents alive and exposes zero-copy slices of their HitStructs.
+/// The parent and slice lists allocate from @p mr (e.g. a FrontendEventArena batch).
 class FrontendEventBankData : public FrontendEventBank {
 public:
-    FrontendEventBankData(std::vector<std::shared_ptr<SampicEvent>> parents,
-                          const std::vector<const HitStruct*>& hits);
+    using SliceList = std::pmr::vector<std::pair<const uint8_t*, size_t>>;
+
+    FrontendEventBankData(const std::vector<std::shared_ptr<SampicEvent>>& parents,
+                          std::span<const HitStruct* const> hits,
+                          std::pmr::memory_resource* mr = std::pmr::get_default_resource());
 
     const uint8_t* data() const override { return nullptr; }  // multi-slice
     size_t size() const override { return total_size_; }
 
-    const std::vector<std::pair<const uint8_t*, size_t>>& slices() const { return slices_; }
+    /// Gather the slices into @p dst.
+    size_t serializeInto(uint8_t* dst, size_t cap) const override;
+
+    const SliceList& slices() const { return slices_; }
 
 private:
-    std::vector<std::shared_ptr<SampicEvent>> parents_;  ///< Keep SampicEvents alive
-    std::vector<std::pair<const uint8_t*, size_t>> slices_;
+    std::pmr::vector<std::shared_ptr<SampicEvent>> parents_;  ///< Keep SampicEvents alive
+    SliceList slices_;
     size_t total_size_{0};
 };
 
@@ -0,0 +1,79 @@
+#ifndef FRONTEND_EVENT_BANK_FEATURES_H
+#define FRONTEND_EVENT_BANK_FEATURES_H
+
+#include "processing/sampic_processing/collector/banks/frontend_event_bank.h"
+#include "processing/sampic_processing/collector/banks/frontend_event_bank_compact_data.h"
+#include "processing/sampic_processing/collector/waveform_feature_extractor.h"
+#include "integration/sampic/collector/sampic_event.h"
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+/**
+ * @class FrontendEventBankFeatures
+ * @brief Per-hit pulse features computed in the frontend; no samples.
+ *
+ * Replaces the waveform payload with a fixed 40-byte record per hit, which
+ * for typical 64-sample hits is about 7x smaller than the COMPACT bank.
+ * Layout (little endian, packed):
+ *
+ *   Header
+ *   Record[n_hits]
+ *
+ * Times that could not be determined (no pulse above the baseline) are NaN.
+ */
+class FrontendEventBankFeatures : public FrontendEventBank {
+public:
+    using HitRef = FrontendEventBankCompactData::HitRef;
+
+#pragma pack(push, 1)
+    struct Header {
+        /** Number of hits in the bank. */
+        uint32_t n_hits;
+
+        /** sizeof(Record), so readers can skip fields added later. */
+        uint16_t record_size;
+
+        /** Layout version, currently 1. */
+        uint16_t version;
+    };
+
+    struct Record {
+        double   first_cell_timestamp;  ///< ns
+        int32_t  hit_number;
+        uint16_t board;
+        uint16_t channel;
+        float    baseline;              ///< V
+        float    amplitude;             ///< V, positive for a pulse of the configured polarity
+        float    charge;                ///< V·ns
+        float    rise_time_ns;          ///< 10-90 %
+        float    cfd_time_ns;           ///< Relative to first_cell_timestamp
+        uint16_t peak_index;
+        uint16_t data_size;
+    };
+#pragma pack(pop)
+
+    static_assert(sizeof(Record) == 40, "FrontendEventBankFeatures::Record layout changed");
+
+    static constexpr uint16_t kVersion = 1;
+
+    /**
+     * @brief Extract and serialize the features of the referenced hits.
+     * @param parents SampicEvents owning the hit tables (only read during construction).
+     * @param hits Rows to serialize, in output order.
+     * @param extractor Feature extractor to run on each waveform.
+     * @param prefix Optional bank prefix (default "AD").
+     */
+    FrontendEventBankFeatures(const std::vector<std::shared_ptr<SampicEvent>>& parents,
+                              const std::vector<HitRef>& hits,
+                              const WaveformFeatureExtractor& extractor,
+                              const std::string& prefix = "AD");
+
+    const uint8_t* data() const override { return buffer_.data(); }
+    size_t size() const override { return buffer_.size(); }
+
+private:
+    std::vector<uint8_t> buffer_;
+};
+
+#endif // FRONTEND_EVENT_BANK_FEATURES_H
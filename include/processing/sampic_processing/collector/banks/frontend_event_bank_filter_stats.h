@@ -0,0 +1,62 @@
+#ifndef FRONTEND_EVENT_BANK_FILTER_STATS_H
+#define FRONTEND_EVENT_BANK_FILTER_STATS_H
+
+#include "processing/sampic_processing/collector/banks/frontend_event_bank.h"
+#include "processing/sampic_processing/collector/frontend_coincidence_filter.h"
+#include <cstdint>
+
+/**
+ * @class FrontendEventBankFilterStats
+ * @brief Publishes the coincidence filter's accept / reject counters.
+ *
+ * Attached next to the collector timing bank when the filter is enabled,
+ * so the rejected fraction can be followed from the data stream. Counters
+ * are cumulative since the collector mode was built at begin of run.
+ */
+class FrontendEventBankFilterStats : public FrontendEventBank {
+public:
+#pragma pack(push, 1)
+    struct Record {
+        /** Timestamp (ns since epoch) when the counters were sampled. */
+        uint64_t timestamp_ns;
+
+        /** Groups passed on to bank creation, and their hits. */
+        uint64_t accepted_groups;
+        uint64_t accepted_hits;
+
+        /** Groups dropped, and their hits. */
+        uint64_t rejected_groups;
+        uint64_t rejected_hits;
+
+        /** Rejections by the first failed condition. */
+        uint64_t failed_min_hits;
+        uint64_t failed_min_channels;
+        uint64_t failed_min_boards;
+        uint64_t failed_masks;
+    };
+#pragma pack(pop)
+
+    /**
+     * @brief Construct the bank from the filter counters.
+     * @param timestamp_ns Sampling time (ns since epoch).
+     * @param stats Filter counters.
+     * @param prefix Optional bank prefix (default "AF").
+     */
+    FrontendEventBankFilterStats(uint64_t timestamp_ns,
+                                 const FrontendFilterStats& stats,
+                                 const std::string& prefix = "AF");
+
+    /** @brief Return pointer to serialized record data. */
+    const uint8_t* data() const override;
+
+    /** @brief Return byte size of serialized record. */
+    size_t size() const override;
+
+    /** @brief Access the filled record. */
+    const Record& record() const { return record_; }
+
+private:
+    Record record_{};
+};
+
+#endif // FRONTEND_EVENT_BANK_FILTER_STATS_H
@@ -0,0 +1,50 @@
+#ifndef FRONTEND_EVENT_BANK_PACKED_DATA_H
+#define FRONTEND_EVENT_BANK_PACKED_DATA_H
+
+#include "processing/sampic_processing/collector/banks/frontend_event_bank.h"
+#include "processing/sampic_processing/collector/banks/packed_sample_codec.h"
+#include "integration/sampic/collector/sampic_event.h"
+#include <vector>
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * @class FrontendEventBankPackedData
+ * @brief Lossless data bank holding the raw ADC codes bit-packed.
+ *
+ * For each hit, the HitStruct scalars go into a PackedSampleCodec::HitHeader,
+ * followed by the first DataSize OrderedRawDataSamples packed at the ADC
+ * width (11 or 12 bits). Only the cells actually read are stored. Codes that
+ * do not fit the configured width are stored at the width they need, so no
+ * sample information is lost; corrected samples are recovered offline from
+ * the codes and the calibration. Decode with PackedSampleCodec::forEachHit().
+ */
+class FrontendEventBankPackedData : public FrontendEventBank {
+public:
+    /// Capacity of HitStruct::OrderedRawDataSamples.
+    static constexpr size_t kMaxCodes = std::extent_v<decltype(HitStruct::OrderedRawDataSamples)>;
+
+    /** @brief Copy the cells read of @p h into @p codes (kMaxCodes long); returns their number. */
+    static size_t loadCodes(const HitStruct& h, int32_t* codes);
+
+    /** @brief HitStruct scalars of @p h with data_size @p n; bits is left 0. */
+    static PackedSampleCodec::HitHeader hitHeader(const HitStruct& h, size_t n);
+
+    /**
+     * @brief Pack the given hits.
+     * @param hits HitStructs to serialize, in output order (only read during construction).
+     * @param min_bits Minimum bits per code, normally the crate's adc_bits.
+     * @param prefix Optional bank prefix (default "AD").
+     */
+    FrontendEventBankPackedData(const std::vector<const HitStruct*>& hits,
+                                unsigned min_bits,
+                                const std::string& prefix = "AD");
+
+    const uint8_t* data() const override { return buffer_.data(); }
+    size_t size() const override { return buffer_.size(); }
+
+private:
+    std::vector<uint8_t> buffer_;
+};
+
+#endif // FRONTEND_EVENT_BANK_PACKED_DATA_H
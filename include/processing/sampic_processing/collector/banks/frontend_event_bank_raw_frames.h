@@ -0,0 +1,34 @@
+#ifndef FRONTEND_EVENT_BANK_RAW_FRAMES_H
+#define FRONTEND_EVENT_BANK_RAW_FRAMES_H
+
+#include "processing/sampic_processing/collector/banks/frontend_event_bank.h"
+#include "integration/sampic/collector/sampic_raw_frames.h"
+#include <memory>
+
+/**
+ * @class FrontendEventBankRawFrames
+ * @brief Undecoded readout bank: one SampicRawFrames record
+ *        (SampicRawFrameHeader + ML_Frame[nframes]).
+ *
+ * Zero-copy: holds a reference to the record produced by
+ * SampicCollectorModeRaw. Decoded offline into the "AD" layout by
+ * scripts/tools/sampic_offline_decoder.
+ */
+class FrontendEventBankRawFrames : public FrontendEventBank {
+public:
+    /**
+     * @param raw Record to expose.
+     * @param prefix Optional bank prefix (default "AR").
+     */
+    explicit FrontendEventBankRawFrames(std::shared_ptr<const SampicRawFrames> raw,
+                                        const std::string& prefix = "AR")
+        : raw_(std::move(raw)) { bank_prefix_ = prefix; }
+
+    const uint8_t* data() const override { return raw_ ? raw_->data() : nullptr; }
+    size_t size() const override { return raw_ ? raw_->size() : 0; }
+
+private:
+    std::shared_ptr<const SampicRawFrames> raw_;
+};
+
+#endif // FRONTEND_EVENT_BANK_RAW_FRAMES_H
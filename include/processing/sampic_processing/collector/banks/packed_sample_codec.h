@@ -0,0 +1,114 @@
+#ifndef PACKED_SAMPLE_CODEC_H
+#define PACKED_SAMPLE_CODEC_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <vector>
+
+/**
+ * @class PackedSampleCodec
+ * @brief Layout and bit packing of the PACKED data bank.
+ *
+ * Depends only on the standard library so offline analysis code can decode
+ * PACKED banks without MIDAS or the SAMPIC libraries. Bank layout (little
+ * endian, no padding):
+ *
+ *   BankHeader
+ *   for each hit:
+ *     HitHeader
+ *     uint8_t codes[packedBytes(data_size, bits)]
+ *
+ * Codes are stored LSB first, @c bits per code, and each hit starts on a
+ * byte boundary. pack() and unpack() use AVX2 when the CPU has it (chosen
+ * at runtime) and produce the same bytes as the scalar path.
+ */
+class PackedSampleCodec {
+public:
+#pragma pack(push, 1)
+    struct BankHeader {
+        /** Number of hits in the bank. */
+        uint32_t n_hits;
+
+        /** sizeof(HitHeader), so readers can skip fields added later. */
+        uint16_t hit_header_size;
+
+        /** Layout version, currently 1. */
+        uint16_t version;
+    };
+
+    struct HitHeader {
+        double   first_cell_timestamp;
+        double   time_instant;
+        float    baseline;
+        float    peak;
+        float    amplitude;
+        float    tot_value;
+        int32_t  hit_number;
+        uint16_t board;
+        uint8_t  chip;
+        uint8_t  channel;
+        uint16_t data_size;  ///< Number of codes stored (cells read)
+        uint8_t  bits;       ///< Bits per code
+        uint8_t  reserved;
+    };
+#pragma pack(pop)
+
+    static constexpr uint16_t kVersion = 1;
+
+    /** @brief Bytes taken by @p n codes of @p bits each. */
+    static constexpr size_t packedBytes(size_t n, unsigned bits) { return (n * bits + 7) / 8; }
+
+    /** @brief Smallest width (1..32) that holds every code in @p codes. */
+    static unsigned requiredBits(const int32_t* codes, size_t n);
+
+    /**
+     * @brief Pack @p n codes into packedBytes(n, bits) bytes at @p out.
+     * @param bits 1..32; higher bits of each code are discarded.
+     */
+    static void pack(const int32_t* codes, size_t n, unsigned bits, uint8_t* out);
+
+    /** @brief Inverse of pack(); reads packedBytes(n, bits) bytes. */
+    static void unpack(const uint8_t* in, size_t n, unsigned bits, int32_t* out);
+
+    /** @brief True if pack()/unpack() run the AVX2 path on this CPU. */
+    static bool vectorized();
+
+    /**
+     * @brief Decode a PACKED bank, calling @p fn(const HitHeader&, std::span<const int32_t>)
+     *        for each hit.
+     * @return False if the bank is truncated or has an unknown layout.
+     */
+    template <typename Fn>
+    static bool forEachHit(const uint8_t* data, size_t size, Fn&& fn) {
+        BankHeader bh;
+        if (size < sizeof(bh))
+            return false;
+        std::memcpy(&bh, data, sizeof(bh));
+        if (bh.version != kVersion || bh.hit_header_size < sizeof(HitHeader))
+            return false;
+
+        std::vector<int32_t> codes;
+        size_t pos = sizeof(bh);
+        for (uint32_t i = 0; i < bh.n_hits; ++i) {
+            HitHeader hh;
+            if (size - pos < bh.hit_header_size)
+                return false;
+            std::memcpy(&hh, data + pos, sizeof(hh));
+            pos += bh.hit_header_size;
+
+            const size_t nbytes = packedBytes(hh.data_size, hh.bits);
+            if (hh.bits == 0 || hh.bits > 32 || size - pos < nbytes)
+                return false;
+            codes.resize(hh.data_size);
+            unpack(data + pos, hh.data_size, hh.bits, codes.data());
+            pos += nbytes;
+
+            fn(hh, std::span<const int32_t>(codes));
+        }
+        return true;
+    }
+};
+
+#endif // PACKED_SAMPLE_CODEC_H
@@ -0,0 +1,103 @@
+#ifndef FRONTEND_BANK_COMPRESSOR_H
+#define FRONTEND_BANK_COMPRESSOR_H
+
+#include "processing/sampic_processing/config/frontend_event_collector_config.h"
+#include "integration/sampic/collector/sampic_event.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class FrontendEventBank;
+class FrontendEventBankCompressedData;
+
+/// Cumulative data bank compression counters.
+struct FrontendCompressionStats {
+    uint64_t banks = 0;
+    uint64_t hits = 0;
+    uint64_t bytes_in = 0;   ///< As uncompressed PACKED banks
+    uint64_t bytes_out = 0;
+    uint64_t busy_ns = 0;    ///< Worker time, summed over workers
+    uint64_t bypassed = 0;   ///< Banks left uncompressed because the queue was full
+
+    float ratio() const {
+        return bytes_out ? static_cast<float>(bytes_in) / static_cast<float>(bytes_out) : 0.0f;
+    }
+    float mbPerSecPerCore() const {
+        return busy_ns ? static_cast<float>(bytes_in * 1e3 / busy_ns) : 0.0f;
+    }
+};
+
+/**
+ * @class FrontendBankCompressor
+ * @brief Worker pool compressing PACKED data banks off the builder's thread.
+ *
+ * submit() returns an empty FrontendEventBankCompressedData at once and
+ * queues the hits; a worker encodes them and completes the bank. The task
+ * keeps the parent SampicEvents (and so the HitStructs) alive until then.
+ * When max_pending_banks are already queued, submit() returns nullptr and
+ * the caller writes an uncompressed bank instead, so the builder never
+ * waits on the pool. submit() may be called from several threads at once.
+ */
+class FrontendBankCompressor {
+public:
+    /**
+     * @param cfg Compression settings.
+     * @param min_bits PACKED code width, for the uncompressed size in the counters.
+     */
+    FrontendBankCompressor(const FrontendCompressionConfig& cfg, unsigned min_bits);
+
+    /** @brief Finish the queued banks, stop the workers and log the counters. */
+    ~FrontendBankCompressor();
+
+    FrontendBankCompressor(const FrontendBankCompressor&) = delete;
+    FrontendBankCompressor& operator=(const FrontendBankCompressor&) = delete;
+
+    /**
+     * @brief Queue @p hits for compression.
+     * @return The bank to attach, or nullptr if the queue is full.
+     */
+    std::shared_ptr<FrontendEventBank> submit(const std::vector<std::shared_ptr<SampicEvent>>& parents,
+                                              std::vector<const HitStruct*> hits);
+
+    /** @brief Counters since construction. */
+    FrontendCompressionStats stats() const;
+
+    /** @brief Banks queued or being compressed. */
+    uint32_t pending() const { return pending_.load(std::memory_order_relaxed); }
+
+    uint32_t numWorkers() const { return static_cast<uint32_t>(workers_.size()); }
+
+private:
+    struct Task {
+        std::shared_ptr<FrontendEventBankCompressedData> bank;
+        std::vector<std::shared_ptr<SampicEvent>> parents;  ///< Keep the HitStructs alive
+        std::vector<const HitStruct*> hits;
+    };
+
+    void workerLoop();
+
+    FrontendCompressionConfig cfg_;
+    unsigned min_bits_;
+
+    std::mutex mtx_;
+    std::condition_variable cv_;
+    std::deque<Task> queue_;
+    bool stop_{false};
+    std::vector<std::thread> workers_;
+
+    std::atomic<uint32_t> pending_{0};
+    std::atomic<uint64_t> banks_{0};
+    std::atomic<uint64_t> hits_{0};
+    std::atomic<uint64_t> bytes_in_{0};
+    std::atomic<uint64_t> bytes_out_{0};
+    std::atomic<uint64_t> busy_ns_{0};
+    std::atomic<uint64_t> bypassed_{0};
+};
+
+#endif // FRONTEND_BANK_COMPRESSOR_H
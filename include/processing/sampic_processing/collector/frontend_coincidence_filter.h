@@ -0,0 +1,70 @@
+#ifndef FRONTEND_COINCIDENCE_FILTER_H
+#define FRONTEND_COINCIDENCE_FILTER_H
+
+#include "processing/sampic_processing/collector/frontend_event_builder.h"
+#include "processing/sampic_processing/config/frontend_event_collector_config.h"
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/// Cumulative coincidence filter counters.
+struct FrontendFilterStats {
+    uint64_t accepted_groups = 0;
+    uint64_t rejected_groups = 0;
+    uint64_t accepted_hits = 0;
+    uint64_t rejected_hits = 0;
+
+    // Rejections by the first condition that failed
+    uint64_t failed_min_hits = 0;
+    uint64_t failed_min_channels = 0;
+    uint64_t failed_min_boards = 0;
+    uint64_t failed_masks = 0;
+};
+
+/**
+ * @class FrontendCoincidenceFilter
+ * @brief Drops finalized groups that do not form a coincidence.
+ *
+ * Applied between finalization and bank creation, so a rejected group
+ * costs no FrontendEvent, banks or MIDAS write. Conditions are checked in
+ * order of cost: hit count, then distinct channels and boards and the
+ * required channel masks, which need one pass over the group's hits.
+ * Only the collector thread may call apply().
+ */
+class FrontendCoincidenceFilter {
+public:
+    using PendingGroup = FrontendEventBuilder::PendingGroup;
+
+    explicit FrontendCoincidenceFilter(const FrontendCoincidenceFilterConfig& cfg);
+
+    /** @brief Log the final counters if the filter was enabled. */
+    ~FrontendCoincidenceFilter();
+
+    bool enabled() const { return cfg_.enabled; }
+
+    /** @brief Remove rejected groups from @p groups, keeping the order of the rest. */
+    void apply(std::vector<PendingGroup>& groups);
+
+    /** @brief Counters since construction. */
+    const FrontendFilterStats& stats() const { return stats_; }
+
+private:
+    /// Which condition rejected a group, if any.
+    enum class Verdict { ACCEPT, MIN_HITS, MIN_CHANNELS, MIN_BOARDS, MASKS };
+
+    Verdict evaluate(const PendingGroup& g);
+
+    const FrontendCoincidenceFilterConfig& cfg_;
+    bool need_scan_;                 ///< Any condition beyond min_hits
+
+    /// required_masks as (board, 64-bit channel mask)
+    std::vector<std::pair<uint16_t, uint64_t>> masks_;
+
+    std::vector<uint64_t> board_channels_;  ///< Hit channel bits per board, for the current group
+    std::vector<uint16_t> touched_;         ///< Boards set in board_channels_
+
+    FrontendFilterStats stats_;
+};
+
+#endif // FRONTEND_COINCIDENCE_FILTER_H
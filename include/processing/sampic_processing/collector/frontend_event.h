@@ -3,8 +3,10 @@
 
 #include <vector>
 #include <memory>
+#include <memory_resource>
 #include <chrono>
 #include <string>
+#include <cstdint>
 #include "processing/sampic_processing/collector/banks/frontend_event_bank.h"
 
 /**
@@ -15,9 +17,13 @@
  * Each FrontendEvent may contain multiple data banks providing payloads
  * or metadata. Timing information is delegated to timing banks.
  * The event also tracks whether it has been consumed downstream.
+ * The bank list may live in a FrontendEventArena batch, in which case
+ * banks must only be added while that batch is open.
  */
 class FrontendEvent {
 public:
+    using BankList = std::pmr::vector<std::shared_ptr<FrontendEventBank>>;
+
     /** @brief Default constructor. */
     FrontendEvent() = default;
 
@@ -27,6 +33,13 @@ public:
      */
     explicit FrontendEvent(std::chrono::steady_clock::time_point ts);
 
+    /**
+     * @brief Construct a new FrontendEvent whose bank list allocates from @p mr.
+     * @param ts Event creation or reference timestamp.
+     * @param mr Memory resource for the bank list (e.g. a FrontendEventArena batch).
+     */
+    FrontendEvent(std::chrono::steady_clock::time_point ts, std::pmr::memory_resource* mr);
+
     /** @brief Virtual destructor. */
     virtual ~FrontendEvent();
 
@@ -46,6 +59,36 @@ public:
      */
     std::chrono::steady_clock::time_point timestamp() const;
 
+    // ------------------------------------------------------------------
+    // Hit count
+    // ------------------------------------------------------------------
+
+    /**
+     * @brief Set the number of SAMPIC hits grouped into this event.
+     * @param n Hit count, used for drop accounting in FrontendEventBuffer.
+     */
+    void setNumHits(size_t n);
+
+    /** @brief Return the number of SAMPIC hits grouped into this event. */
+    size_t numHits() const;
+
+    /**
+     * @brief Set the hardware time span and boards of the grouped hits.
+     * @param first_ts Earliest FirstCellTimeStamp of the hits.
+     * @param last_ts Latest FirstCellTimeStamp of the hits.
+     * @param board_mask Bit b set if board b has hits (boards 63 and up share bit 63).
+     */
+    void setHitSummary(double first_ts, double last_ts, uint64_t board_mask);
+
+    /** @brief Earliest FirstCellTimeStamp of the hits (0 if not set). */
+    double firstHitTimestamp() const;
+
+    /** @brief Latest FirstCellTimeStamp of the hits (0 if not set). */
+    double lastHitTimestamp() const;
+
+    /** @brief Boards with hits, as set by setHitSummary(). */
+    uint64_t boardMask() const;
+
     // ------------------------------------------------------------------
     // Bank management
     // ------------------------------------------------------------------
@@ -60,13 +103,13 @@ public:
      * @brief Access all banks (const).
      * @return Const reference to the vector of attached banks.
      */
-    const std::vector<std::shared_ptr<FrontendEventBank>>& banks() const;
+    const BankList& banks() const;
 
     /**
      * @brief Access all banks (mutable).
      * @return Reference to the vector of attached banks.
      */
-    std::vector<std::shared_ptr<FrontendEventBank>>& banks();
+    BankList& banks();
 
     /**
      * @brief Find a bank by its prefix string.
@@ -114,7 +157,11 @@ public:
 
 private:
     std::chrono::steady_clock::time_point timestamp_{}; ///< Event timestamp
-    std::vector<std::shared_ptr<FrontendEventBank>> banks_; ///< Attached data banks
+    BankList banks_; ///< Attached data banks
+    size_t num_hits_{0}; ///< Number of SAMPIC hits grouped into this event
+    double first_hit_ts_{0.0}; ///< Earliest hit FirstCellTimeStamp
+    double last_hit_ts_{0.0}; ///< Latest hit FirstCellTimeStamp
+    uint64_t board_mask_{0}; ///< Boards with hits
     bool consumed_{false}; ///< Indicates if this event has been processed downstream
 };
 
@@ -0,0 +1,90 @@
+#ifndef FRONTEND_EVENT_ARENA_H
+#define FRONTEND_EVENT_ARENA_H
+
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <vector>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+
+/// Snapshot of FrontendEventArena usage.
+struct FrontendEventArenaStats {
+    size_t blocks = 0;            ///< Preallocated blocks
+    size_t block_bytes = 0;       ///< Bytes per block
+    size_t available = 0;         ///< Blocks currently free
+    size_t in_use_high_water = 0; ///< Largest number of blocks out at once
+    uint64_t batches = 0;         ///< Batches served from a block
+    uint64_t exhausted = 0;       ///< Batches served by the heap because every block was in use
+    uint64_t overflowed = 0;      ///< Batches that outgrew their block and spilled to the heap
+};
+
+/**
+ * @brief Recycling per-cycle arena for FrontendEvents and their banks.
+ *
+ * Each collector cycle opens a batch with beginBatch() and allocates the
+ * cycle's FrontendEvents, banks and their vectors from the returned
+ * std::pmr::memory_resource, a monotonic buffer over one preallocated block.
+ * Individual frees only count down; once the batch is closed with
+ * endBatch() and the last object built from it is freed (normally after
+ * MIDAS readout, on the readout thread), the block is released in bulk and
+ * returned to the free list. Steady-state event building thus never
+ * touches the global heap.
+ *
+ * Allocation from an open batch is thread-safe, so the sorted mode may
+ * build groups from its worker pool. Nothing may allocate from a batch
+ * after endBatch(); objects that grow later (e.g. FrontendEvent::addBank
+ * on an already published event) must not use the arena.
+ *
+ * When every block is in use, beginBatch() hands out the default heap
+ * resource (counted as exhausted); a batch larger than a block spills to
+ * the heap for the rest of that batch (counted as overflowed).
+ *
+ * Must be owned by a std::shared_ptr: blocks with live objects keep the
+ * arena alive, so it may outlive the collector mode that created it.
+ */
+class FrontendEventArena : public std::enable_shared_from_this<FrontendEventArena> {
+public:
+    /**
+     * @param num_blocks Number of blocks to preallocate.
+     * @param block_bytes Size of each block.
+     */
+    FrontendEventArena(size_t num_blocks, size_t block_bytes);
+    ~FrontendEventArena();
+
+    FrontendEventArena(const FrontendEventArena&) = delete;
+    FrontendEventArena& operator=(const FrontendEventArena&) = delete;
+
+    /**
+     * @brief Open a batch, closing the previous one if still open.
+     * @return Resource to allocate this cycle's objects from.
+     */
+    std::pmr::memory_resource* beginBatch();
+
+    /** @brief Close the open batch; its block recycles once all its objects are freed. */
+    void endBatch();
+
+    /** @brief Snapshot of arena usage counters. */
+    FrontendEventArenaStats stats() const;
+
+private:
+    class Block;
+
+    /// Return a drained block to the free list.
+    void recycle(Block* block);
+
+    size_t block_bytes_;
+    std::vector<std::unique_ptr<Block>> blocks_;
+    Block* current_{nullptr};  ///< Open batch, collector thread only
+
+    mutable std::mutex mtx_;
+    std::vector<Block*> free_;
+    size_t in_use_high_water_{0};
+
+    std::atomic<uint64_t> batches_{0};
+    std::atomic<uint64_t> exhausted_{0};
+    std::atomic<uint64_t> overflowed_{0};
+};
+
+#endif // FRONTEND_EVENT_ARENA_H
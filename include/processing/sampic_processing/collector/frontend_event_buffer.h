@@ -8,7 +8,27 @@
 #include <chrono>
 #include <vector>
 #include <memory>
+#include <string>
+#include <cstdint>
 #include "processing/sampic_processing/collector/frontend_event.h"
+#include "integration/sampic/collector/buffer_stats.h"
+#include "integration/sampic/config/buffer_overflow_config.h"
+
+/// What happens to a registered consumer of a FrontendEventBuffer that falls behind.
+enum class FrontendEventConsumerPolicy {
+    BLOCK,  ///< Events are held until this consumer has read them; when it falls behind, the
+            ///< buffer's overflow policy applies (BLOCK there stalls the collector instead of dropping)
+    DROP    ///< Never holds events: those evicted before it reads them are skipped and counted as missed
+};
+
+/// Counters of one registered consumer (see FrontendEventBuffer::consumerStats()).
+struct FrontendEventConsumerStats {
+    std::string name;
+    FrontendEventConsumerPolicy policy = FrontendEventConsumerPolicy::BLOCK;
+    uint64_t read = 0;    ///< Events returned by consume()
+    uint64_t missed = 0;  ///< Events evicted before this consumer read them
+    uint64_t pending = 0; ///< Events pushed that it has not read yet
+};
 
 /**
  * @class FrontendEventBuffer
@@ -17,14 +37,34 @@
  * Provides blocking and non-blocking access methods for both producers
  * (push) and consumers (pop, getSince, etc.). The buffer maintains
  * timestamp ordering and notifies waiting threads on new arrivals.
+ *
+ * Each pushed event receives a monotonically increasing sequence number
+ * (starting at 1). Consumers hold a cursor with the last sequence they have
+ * read (0 = nothing yet); the cursor overloads return exactly the events
+ * after it in O(new events), independent of timestamps.
+ *
+ * Entries are released as soon as every reader has read them, since they
+ * may pin arena blocks and SampicEvents upstream. Only unread entries are
+ * subject to the configured BufferOverflowPolicy and counted as dropped in
+ * stats().
+ *
+ * Several readers (MIDAS readout, the file writer, a monitor) can share the
+ * buffer as registered consumers, each with its own cursor kept here and a
+ * FrontendEventConsumerPolicy. An entry counts as read once every BLOCK
+ * consumer has read it; DROP consumers never hold entries back, so a slow
+ * monitor cannot throttle the data path. Without BLOCK consumers, the
+ * furthest cursor of the unregistered getSince() calls decides, as before.
+ * A DROP consumer that is behind keeps entries only until the buffer is
+ * full, which bounds its window to the capacity.
  */
 class FrontendEventBuffer {
 public:
     /**
      * @brief Construct a new FrontendEventBuffer with the given capacity.
-     * @param capacity Maximum number of events stored before oldest are dropped.
+     * @param capacity Maximum number of events stored.
+     * @param overflow Policy applied when a push finds the buffer full of unread events.
      */
-    explicit FrontendEventBuffer(size_t capacity);
+    explicit FrontendEventBuffer(size_t capacity, const BufferOverflowConfig& overflow = {});
 
     // ------------------------------------------------------------------
     // Producer interface
@@ -33,7 +73,9 @@ public:
     /**
      * @brief Add a new event to the buffer.
      * 
-     * If the buffer is full, the oldest event is removed. This function
+     * If the buffer is full, already-read events are evicted first; otherwise
+     * the overflow policy decides whether the oldest unread event or the new
+     * one is dropped, or whether the caller blocks for space. This function
      * signals any threads waiting on new data.
      *
      * @param ev Shared pointer to the FrontendEvent to push.
@@ -67,6 +109,60 @@ public:
      */
     std::vector<std::shared_ptr<FrontendEvent>> getSince(std::chrono::steady_clock::time_point t);
 
+    /**
+     * @brief Retrieve all events pushed after a cursor and advance it.
+     *
+     * Events evicted before they were read are skipped.
+     *
+     * @param cursor Last sequence number seen; updated to the last returned one.
+     * @return Vector of shared pointers to the events after the cursor.
+     */
+    std::vector<std::shared_ptr<FrontendEvent>> getSince(uint64_t& cursor);
+
+    // ------------------------------------------------------------------
+    // Registered consumers
+    // ------------------------------------------------------------------
+
+    /// Handle returned by addConsumer(); invalid after removeConsumer().
+    using ConsumerId = uint32_t;
+
+    /**
+     * @brief Register a consumer with its own cursor.
+     *
+     * The consumer starts at the oldest stored event.
+     *
+     * @param name Name used in logs and consumerStats().
+     * @param policy What happens when the consumer falls behind.
+     */
+    ConsumerId addConsumer(const std::string& name, FrontendEventConsumerPolicy policy);
+
+    /** @brief Unregister a consumer; events it held are released. */
+    void removeConsumer(ConsumerId id);
+
+    /**
+     * @brief Retrieve the events the consumer has not read yet and advance its cursor.
+     *
+     * Events evicted before the consumer read them are skipped and counted
+     * as missed.
+     */
+    std::vector<std::shared_ptr<FrontendEvent>> consume(ConsumerId id);
+
+    /** @brief Number of events pushed that the consumer has not read yet. */
+    uint64_t pending(ConsumerId id) const;
+
+    /**
+     * @brief Wait until at least @p count events are pending for the consumer
+     *        or timeout expires.
+     * @return True if @p count events became pending before timeout.
+     */
+    bool waitForConsumer(ConsumerId id, uint64_t count, std::chrono::microseconds timeout);
+
+    /** @brief Counters of one consumer (default values if @p id is not registered). */
+    FrontendEventConsumerStats consumerStats(ConsumerId id) const;
+
+    /** @brief Counters of all registered consumers. */
+    std::vector<FrontendEventConsumerStats> consumerStats() const;
+
     // ------------------------------------------------------------------
     // Polling helpers
     // ------------------------------------------------------------------
@@ -78,6 +174,13 @@ public:
      */
     bool hasNewSince(std::chrono::steady_clock::time_point t) const;
 
+    /**
+     * @brief Check if events were pushed after a cursor.
+     * @param cursor Last sequence number seen.
+     * @return True if newer events exist.
+     */
+    bool hasNewSince(uint64_t cursor) const;
+
     /**
      * @brief Wait until a new event arrives or timeout expires.
      * @param t Reference timestamp to compare against.
@@ -87,6 +190,30 @@ public:
     bool waitForNew(std::chrono::steady_clock::time_point t,
                     std::chrono::milliseconds timeout);
 
+    /**
+     * @brief Wait until an event is pushed after a cursor or timeout expires.
+     * @param cursor Last sequence number seen.
+     * @param timeout Maximum wait duration.
+     * @return True if a new event became available before timeout.
+     */
+    bool waitForNew(uint64_t cursor, std::chrono::milliseconds timeout);
+
+    /**
+     * @brief Wait until at least @p count events were pushed after a cursor
+     *        or timeout expires.
+     * @param cursor Last sequence number seen.
+     * @param count Number of new events to wait for.
+     * @param timeout Maximum wait duration.
+     * @return True if @p count new events became available before timeout.
+     */
+    bool waitForCount(uint64_t cursor, uint64_t count, std::chrono::microseconds timeout);
+
+    /**
+     * @brief Sequence number of the most recently pushed event.
+     * @return Last sequence number, or 0 if nothing was pushed yet.
+     */
+    uint64_t lastSequence() const;
+
     /**
      * @brief Get the number of events currently stored.
      * @return Current buffer size.
@@ -99,13 +226,58 @@ public:
      */
     bool empty() const;
 
+    /**
+     * @brief Snapshot of the push / drop counters.
+     * @return Counters, unread occupancy and capacity.
+     */
+    BufferStats stats() const;
+
 private:
-    size_t capacity_; ///< Maximum number of events before oldest are dropped.
+    /// One stored event with its push timestamp and sequence number.
+    struct Entry {
+        std::shared_ptr<FrontendEvent> ev;
+        std::chrono::steady_clock::time_point ts;
+        uint64_t seq;
+    };
+
+    /// A registered consumer.
+    struct Consumer {
+        FrontendEventConsumerStats stats;
+        uint64_t cursor{0};   ///< Last sequence number read
+        bool active{false};
+    };
+
+    /// Sequence up to which entries are read and can be evicted without loss. Caller holds mtx_.
+    uint64_t heldFrom() const;
+
+    /// Sequence up to which every reader, DROP consumers included, has read. Caller holds mtx_.
+    uint64_t readByAll() const;
+
+    /// Pop the entries up to readByAll(). Caller holds mtx_.
+    void releaseRead();
+
+    /// Counters of @p c as of now. Caller holds mtx_.
+    FrontendEventConsumerStats statsOf(const Consumer& c) const;
+
+    /// Number of entries not yet read per heldFrom(). Caller holds mtx_.
+    uint64_t unreadCount() const;
+
+    /// Make room for one entry per the overflow policy. Caller holds mtx_.
+    /// @return false if the incoming event must be dropped.
+    bool makeRoom(std::unique_lock<std::mutex>& lock);
+
+    size_t capacity_; ///< Maximum number of events stored.
+    BufferOverflowConfig overflow_; ///< Policy applied when full of unread events.
+    BufferStatsCounters counters_; ///< Push / drop accounting.
     mutable std::mutex mtx_; ///< Mutex for thread safety.
     std::condition_variable cv_; ///< Condition variable for push notifications.
-    std::deque<std::pair<std::shared_ptr<FrontendEvent>,
-                         std::chrono::steady_clock::time_point>> buffer_; ///< Stored events and timestamps.
+    std::condition_variable space_cv_; ///< Signalled when a consumer reads, for BLOCK.
+    std::deque<Entry> buffer_; ///< Stored events, timestamps and sequence numbers.
     std::chrono::steady_clock::time_point last_timestamp_{}; ///< Timestamp of last received event.
+    uint64_t last_seq_{0}; ///< Sequence number of last received event.
+    uint64_t read_seq_{0}; ///< Furthest sequence number handed to an unregistered consumer.
+    std::vector<Consumer> consumers_; ///< Registered consumers; slots are reused after removal.
+    size_t blocking_consumers_{0}; ///< Active consumers with the BLOCK policy.
 };
 
 #endif // FRONTEND_EVENT_BUFFER_H
@@ -0,0 +1,93 @@
+#ifndef FRONTEND_EVENT_BUILDER_H
+#define FRONTEND_EVENT_BUILDER_H
+
+#include "processing/sampic_processing/collector/frontend_event.h"
+#include "processing/sampic_processing/collector/banks/frontend_event_bank_compact_data.h"
+#include "processing/sampic_processing/collector/banks/frontend_event_bank_collector_timing.h"
+#include "processing/sampic_processing/collector/waveform_feature_extractor.h"
+#include "processing/sampic_processing/collector/frontend_bank_compressor.h"
+#include "processing/sampic_processing/collector/frontend_event_arena.h"
+#include "processing/sampic_processing/config/frontend_event_collector_config.h"
+#include "integration/sampic/collector/buffer_stats.h"
+#include "integration/sampic/collector/sampic_event.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+struct FrontendFilterStats;
+
+/**
+ * @class FrontendEventBuilder
+ * @brief Turns grouped hits into FrontendEvents with their banks.
+ *
+ * Shared by the frontend collector modes so that every grouping strategy
+ * produces identical output: a data bank in the configured format, the
+ * per-event timing bank, and the collector timing / buffer stats banks on
+ * the last event of each collection cycle. buildGroupEvent() may be called
+ * from several threads at once.
+ *
+ * With use_event_arena, the events and banks built between beginCycle()
+ * and endCycle() are carved from one FrontendEventArena batch, which is
+ * recycled in bulk once readout has released all of them.
+ */
+class FrontendEventBuilder {
+public:
+    using HitRef = FrontendEventBankCompactData::HitRef;
+
+    /// Hits grouped into one FrontendEvent.
+    struct PendingGroup {
+        std::chrono::steady_clock::time_point created;
+        double t0_ns{0.0};                                  ///< FirstCellTimeStamp of the first hit
+        std::vector<std::shared_ptr<SampicEvent>> parents;  ///< References to contributing SampicEvents
+        std::vector<HitRef> hits;                           ///< (parent index, hit table row) pairs
+    };
+
+    explicit FrontendEventBuilder(const FrontendCollectorModeDefaultConfig& cfg);
+    ~FrontendEventBuilder();
+
+    /** @brief Open the arena batch for one collection cycle (no-op without the arena). */
+    void beginCycle();
+
+    /** @brief Close the cycle's arena batch; its events must not gain banks afterwards. */
+    void endCycle();
+
+    /** @brief Build the FrontendEvent (data + event timing banks) for a group. */
+    std::shared_ptr<FrontendEvent> buildGroupEvent(const PendingGroup& g);
+
+    /** @brief Build the FrontendEvent for an undecoded SampicEvent (raw frames + event timing banks). */
+    std::shared_ptr<FrontendEvent> buildRawEvent(const std::shared_ptr<SampicEvent>& ev);
+
+    /**
+     * @brief Attach the collector timing and buffer stats banks to @p last,
+     *        plus the filter counters bank if @p filter_stats is given and
+     *        the compression counters bank if compression is enabled.
+     */
+    void attachCycleBanks(FrontendEvent& last,
+                          const FrontendEventBankCollectorTiming::Record& rec,
+                          const BufferStats& sampic_stats,
+                          const BufferStats& frontend_stats,
+                          const FrontendFilterStats* filter_stats = nullptr);
+
+private:
+    /// Build the data bank for a group in the configured format.
+    std::shared_ptr<FrontendEventBank> buildDataBank(const PendingGroup& g);
+
+    /// make_shared from the current cycle's arena batch (or the heap).
+    template <typename T, typename... Args>
+    std::shared_ptr<T> allocate(Args&&... args) const {
+        return std::allocate_shared<T>(std::pmr::polymorphic_allocator<T>(mr_),
+                                       std::forward<Args>(args)...);
+    }
+
+    const FrontendCollectorModeDefaultConfig& cfg_;
+    WaveformFeatureExtractor extractor_;
+    std::unique_ptr<FrontendBankCompressor> compressor_;  ///< PACKED compression, if enabled
+    std::shared_ptr<FrontendEventArena> arena_;  ///< Per-cycle allocation, if enabled
+    std::pmr::memory_resource* mr_;               ///< Current cycle's batch, or the heap
+    std::atomic<bool> warned_no_event_struct_{false};
+};
+
+#endif // FRONTEND_EVENT_BUILDER_H
@@ -28,18 +28,30 @@ public:
     void setConfig(const FrontendEventCollectorConfig& cfg);
     int  applySettings();
 
+    /**
+     * @brief Point at a new SAMPIC buffer (e.g. after SampicController::applySettings()
+     *        rebuilt it). Takes effect at the next applySettings().
+     */
+    void setSampicBuffer(SampicEventBuffer& sampic_buffer);
+
     const FrontendEventCollectorConfig& config() const { return cfg_; }
 
     FrontendEventBuffer& buffer() { return *buffer_; }
     const FrontendEventBuffer& buffer() const { return *buffer_; }
 
+    /**
+     * @brief Shared handle to the current buffer, for a reader that waits on it
+     *        outside the lock serializing applySettings(), which replaces it.
+     */
+    std::shared_ptr<FrontendEventBuffer> sharedBuffer() const { return buffer_; }
+
 private:
     void run();
     void buildMode(); ///< internal factory for collector mode
 
-    SampicEventBuffer& sampic_buffer_;
+    SampicEventBuffer* sampic_buffer_;
     FrontendEventCollectorConfig cfg_;
-    std::unique_ptr<FrontendEventBuffer> buffer_;
+    std::shared_ptr<FrontendEventBuffer> buffer_;
     std::unique_ptr<FrontendCollectorMode> mode_;
 
     std::thread worker_;
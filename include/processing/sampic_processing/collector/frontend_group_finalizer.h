@@ -0,0 +1,71 @@
+#ifndef FRONTEND_GROUP_FINALIZER_H
+#define FRONTEND_GROUP_FINALIZER_H
+
+#include "processing/sampic_processing/collector/frontend_event_builder.h"
+#include "processing/sampic_processing/config/frontend_event_collector_config.h"
+#include "integration/sampic/collector/sampic_hit_table.h"
+
+#include <chrono>
+#include <vector>
+
+/**
+ * @class FrontendGroupFinalizer
+ * @brief Decides when a pending group can no longer receive hits.
+ *
+ * WALL_CLOCK closes a group finalize_after_ms after it was opened, as the
+ * collector modes always have. WATERMARK tracks the latest FirstCellTimeStamp
+ * seen on each board; the watermark is the minimum of these over the boards
+ * that reported within board_idle_ms. Assuming each board reads out in time
+ * order, no later hit can fall before the watermark, so a group whose window
+ * ends before it is complete. This depends only on hardware time, so the
+ * same data gives the same events however the host is loaded.
+ *
+ * Boards listed in watermark_boards that have not reported yet count as
+ * active from the first hit on, so early readouts from one board do not
+ * close groups another board is still filling. When every board is idle
+ * there is no watermark, and groups fall back to the wall-clock rule so
+ * the tail of a burst is still emitted.
+ */
+class FrontendGroupFinalizer {
+public:
+    explicit FrontendGroupFinalizer(const FrontendCollectorModeDefaultConfig& cfg);
+
+    /** @brief Advance the per-board hardware times with one decoded event's hits. */
+    void observe(const SampicHitTable& table, std::chrono::steady_clock::time_point now);
+
+    /** @brief Fix the wall-clock cutoff and watermark for this cycle; call before isReady(). */
+    void update(std::chrono::steady_clock::time_point now);
+
+    /** @brief True once no further hit can join @p g. */
+    bool isReady(const FrontendEventBuilder::PendingGroup& g) const;
+
+    /**
+     * @brief Longest the collector should wait for new data while groups are
+     *        pending, so idle-time finalization is not delayed by wait_timeout_ms.
+     */
+    std::chrono::milliseconds recheckInterval() const { return recheck_; }
+
+    /// Watermark from the last update() (ns); NaN when undefined.
+    double watermark() const { return watermark_ns_; }
+
+private:
+    struct BoardClock {
+        double max_ts_ns{0.0};
+        std::chrono::steady_clock::time_point last_seen{};
+        bool seen{false};
+    };
+
+    FrontendFinalizePolicy policy_;
+    double window_ns_;
+    double margin_ns_;
+    std::chrono::milliseconds finalize_after_;
+    std::chrono::milliseconds board_idle_;
+    std::chrono::milliseconds recheck_;
+
+    std::vector<BoardClock> boards_;  ///< Indexed by FeBoardIndex
+    bool started_{false};             ///< Set by the first observed hit
+    std::chrono::steady_clock::time_point cutoff_{};
+    double watermark_ns_;
+};
+
+#endif // FRONTEND_GROUP_FINALIZER_H
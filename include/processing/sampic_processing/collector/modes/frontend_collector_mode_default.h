@@ -3,19 +3,32 @@
 
 #include "processing/sampic_processing/collector/modes/frontend_collector_mode.h"
 #include "processing/sampic_processing/collector/frontend_event.h"
-#include "processing/sampic_processing/collector/banks/frontend_event_bank_data.h"
+#include "processing/sampic_processing/collector/frontend_event_builder.h"
+#include "processing/sampic_processing/collector/frontend_group_finalizer.h"
+#include "processing/sampic_processing/collector/frontend_coincidence_filter.h"
 
 #include <deque>
 #include <vector>
 #include <memory>
 #include <chrono>
+#include <cstdint>
 
 /**
  * @class FrontendCollectorModeDefault
  * @brief Groups temporally close hits from SAMPIC events into FrontendEvents.
  *
  * Performs low-overhead grouping and packaging of events with minimal
- * allocations, intended for high-rate operation.
+ * allocations, intended for high-rate operation: group vectors are reused
+ * and each cycle's events are built in a FrontendEventArena batch. Grouping reads hit
+ * timestamps from each SampicEvent's SampicHitTable; the data bank is
+ * built either from HitStruct slices or from the table columns
+ * (data_bank_format). Groups are closed by FrontendGroupFinalizer, either
+ * by age or by the hardware-time watermark (finalize_policy), and pass the
+ * optional coincidence filter before their banks are built.
+ *
+ * SampicEvents carrying undecoded frames (RAW collector mode) bypass
+ * grouping: each becomes its own FrontendEvent with an "AR" bank, since
+ * hit times are unknown until the offline decode.
  */
 class FrontendCollectorModeDefault : public FrontendCollectorMode {
 public:
@@ -26,23 +39,24 @@ public:
     bool collect() override;
 
 private:
-    struct PendingGroup {
-        std::chrono::steady_clock::time_point created;
-        std::vector<std::shared_ptr<SampicEvent>> parents;  ///< References to contributing SampicEvents
-        std::vector<const HitStruct*> hits;                 ///< Direct pointers to hits (zero-copy)
-    };
+    using HitRef = FrontendEventBuilder::HitRef;
+    using PendingGroup = FrontendEventBuilder::PendingGroup;
 
     // Persistent working sets to avoid per-iteration allocations
     std::deque<PendingGroup> pending_groups_;
     std::vector<PendingGroup> ready_groups_;
+    std::vector<PendingGroup> spare_groups_;  ///< Emptied groups whose vectors are reused
+    std::vector<std::shared_ptr<SampicEvent>> raw_events_;  ///< Undecoded events, passed through
     std::vector<std::shared_ptr<FrontendEvent>> emitted_events_;
 
-    std::chrono::steady_clock::time_point last_timestamp_{std::chrono::steady_clock::time_point::min()};
+    uint64_t sampic_cursor_{0};  ///< Last SampicEventBuffer sequence consumed
 
     const FrontendCollectorModeDefaultConfig& mode_cfg_;
-    std::chrono::milliseconds finalize_after_;
     std::chrono::milliseconds wait_timeout_;
     double time_window_ns_;
+    FrontendEventBuilder builder_;
+    FrontendGroupFinalizer finalizer_;
+    FrontendCoincidenceFilter filter_;
 };
 
 #endif // FRONTEND_COLLECTOR_MODE_DEFAULT_H
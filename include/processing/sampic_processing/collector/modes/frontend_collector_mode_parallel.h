@@ -0,0 +1,84 @@
+#ifndef FRONTEND_COLLECTOR_MODE_PARALLEL_H
+#define FRONTEND_COLLECTOR_MODE_PARALLEL_H
+
+#include "processing/sampic_processing/collector/modes/frontend_collector_mode_sorted.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @class FrontendCollectorModeParallel
+ * @brief Sorted-sweep event building spread over a worker pool.
+ *
+ * Builds the same events as FrontendCollectorModeSorted, with the per-cycle
+ * work split across num_workers threads plus the collector thread:
+ * per-event sorting, the passes of the k-way merge, group assignment and
+ * bank construction.
+ *
+ * Group assignment is split into contiguous time slices. A slice only starts
+ * at a hit more than time_window_ns after its predecessor, and after every
+ * group still open from earlier cycles. No hit in it can then join a group
+ * from before the cut, so each slice is swept independently and its groups
+ * are appended in time order. Hits that could still reach an open group are
+ * swept serially first. A slice that has no such gap near its nominal end
+ * grows until one is found, so sustained occupancy without gaps falls back
+ * to fewer, larger slices rather than to different events.
+ */
+class FrontendCollectorModeParallel : public FrontendCollectorModeSorted {
+public:
+    FrontendCollectorModeParallel(SampicEventBuffer& sampic_buffer,
+                                  FrontendEventBuffer& frontend_buffer,
+                                  const FrontendEventCollectorConfig& cfg);
+
+    /** @brief Stop the worker threads. */
+    ~FrontendCollectorModeParallel() override;
+
+protected:
+    void parallelFor(size_t n, const std::function<void(size_t)>& fn) override;
+
+    void assignHits(const std::vector<std::shared_ptr<SampicEvent>>& events,
+                    std::chrono::steady_clock::time_point now,
+                    HitIter first, HitIter last) override;
+
+private:
+    /// Groups built from one time slice, with slice-local group ids.
+    struct Slice {
+        HitIter first;
+        HitIter last;
+        std::vector<PendingGroup> groups;
+        std::vector<ParentMarker> markers;  ///< Per event; group_id indexes groups
+    };
+
+    /// First position at or after @p p where a slice may start.
+    HitIter nextCut(HitIter p, HitIter first, HitIter last) const;
+
+    /// Worker thread body.
+    void workerLoop();
+
+    /// Claim and run tasks of the current job until none are left.
+    void runTasks();
+
+    /// Direct reference to the mode-specific configuration block.
+    const FrontendCollectorModeParallelConfig& parallel_cfg_;
+
+    std::vector<Slice> slices_;
+    size_t n_slices_{0};
+
+    // Fork-join pool; the collector thread runs tasks too
+    std::vector<std::thread> workers_;
+    std::mutex mtx_;
+    std::condition_variable work_cv_;   ///< Workers: new job or stopping
+    std::condition_variable done_cv_;   ///< Collector: all workers left the job
+    const std::function<void(size_t)>* job_{nullptr};
+    size_t job_size_{0};
+    std::atomic<size_t> next_task_{0};
+    size_t busy_workers_{0};
+    uint64_t generation_{0};
+    bool stopping_{false};
+};
+
+#endif // FRONTEND_COLLECTOR_MODE_PARALLEL_H
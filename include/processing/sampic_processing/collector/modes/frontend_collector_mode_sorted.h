@@ -0,0 +1,120 @@
+#ifndef FRONTEND_COLLECTOR_MODE_SORTED_H
+#define FRONTEND_COLLECTOR_MODE_SORTED_H
+
+#include "processing/sampic_processing/collector/modes/frontend_collector_mode.h"
+#include "processing/sampic_processing/collector/frontend_event_builder.h"
+#include "processing/sampic_processing/collector/frontend_group_finalizer.h"
+#include "processing/sampic_processing/collector/frontend_coincidence_filter.h"
+
+#include <deque>
+#include <functional>
+#include <vector>
+#include <memory>
+#include <chrono>
+#include <cstdint>
+
+/**
+ * @class FrontendCollectorModeSorted
+ * @brief Groups hits in one time-ordered sweep instead of a scan per hit.
+ *
+ * The hits of all new SampicEvents are k-way merged by FirstCellTimeStamp
+ * and assigned against the open groups, which are kept ordered by their
+ * first-hit time t0. A hit joins the earliest open group with
+ * |ts - t0| <= time_window_ns (found by binary search), otherwise it opens
+ * a new one. For time-ordered input this is the same assignment the
+ * default mode finds by scanning, at O(H log K + H log G) for H hits from
+ * K events with G open groups instead of O(H x G).
+ *
+ * Because hits arrive in time order, the group a given SampicEvent's hits
+ * join never moves backwards, so parents are deduplicated with a per-event
+ * "last group" marker instead of a search through group.parents.
+ *
+ * Groups are finalized by FrontendGroupFinalizer as in the default mode
+ * and emitted in t0 order. With WATERMARK finalization, hits at or past
+ * the watermark (less watermark_margin_ns) are held back until it moves
+ * on, since a slower board may still deliver earlier hits. Every hit is
+ * then swept in global time order, so the events depend only on the
+ * hardware timestamps and not on how readouts were batched. All settings except sort_within_event come
+ * from default_mode.
+ */
+class FrontendCollectorModeSorted : public FrontendCollectorMode {
+public:
+    FrontendCollectorModeSorted(SampicEventBuffer& sampic_buffer,
+                                FrontendEventBuffer& frontend_buffer,
+                                const FrontendEventCollectorConfig& cfg);
+
+    bool collect() override;
+
+protected:
+    using HitRef = FrontendEventBuilder::HitRef;
+    using PendingGroup = FrontendEventBuilder::PendingGroup;
+
+    /// One hit in the merged stream.
+    struct MergedHit {
+        double ts;
+        uint32_t event;  ///< Index into new_events
+        uint32_t row;    ///< Row in that event's hit table
+    };
+
+    /// Per-SampicEvent dedup marker: the last group it was added to.
+    struct ParentMarker {
+        uint64_t group_id{UINT64_MAX};
+        uint32_t parent{0};
+    };
+
+    /// Open group plus a stable id (deque positions shift on insert).
+    struct OpenGroup {
+        uint64_t id;
+        PendingGroup g;
+    };
+
+    using HitIter = std::vector<MergedHit>::const_iterator;
+
+    /// Run fn(0) ... fn(n - 1), which touch disjoint data. Serial here.
+    virtual void parallelFor(size_t n, const std::function<void(size_t)>& fn);
+
+    /// Assign the time-ordered hits [first, last) to open_groups_, updating markers_.
+    virtual void assignHits(const std::vector<std::shared_ptr<SampicEvent>>& events,
+                            std::chrono::steady_clock::time_point now,
+                            HitIter first, HitIter last);
+
+    /// Fill merged_ with held_hits_ and the hits of the events from
+    /// held_events_.size() on, in FirstCellTimeStamp order.
+    void mergeHits(const std::vector<std::shared_ptr<SampicEvent>>& events);
+
+    /// Assign the merged hits before @p limit_ns to open groups and hold back the rest.
+    void sweep(const std::vector<std::shared_ptr<SampicEvent>>& events,
+               std::chrono::steady_clock::time_point now,
+               double limit_ns);
+
+    // Persistent working sets to avoid per-iteration allocations
+    std::deque<OpenGroup> open_groups_;          ///< Ordered by g.t0_ns
+    std::vector<PendingGroup> ready_groups_;
+    std::vector<std::shared_ptr<SampicEvent>> decoded_events_;
+    std::vector<std::shared_ptr<SampicEvent>> raw_events_;
+    std::vector<std::shared_ptr<FrontendEvent>> emitted_events_;
+    std::vector<MergedHit> merged_;              ///< All new hits, sorted by timestamp after mergeHits()
+    std::vector<MergedHit> scratch_;             ///< Merge pass output
+    std::vector<size_t> bounds_;                 ///< Run boundaries in merged_
+    std::vector<size_t> next_bounds_;
+    std::vector<ParentMarker> markers_;
+
+    // Hits held back past the watermark, with the events they belong to
+    std::vector<MergedHit> held_hits_;           ///< Sorted; event indexes held_events_
+    std::vector<std::shared_ptr<SampicEvent>> held_events_;
+    std::vector<ParentMarker> held_markers_;     ///< Carried so parents are not added twice
+    std::vector<uint32_t> remap_;
+
+    uint64_t sampic_cursor_{0};  ///< Last SampicEventBuffer sequence consumed
+    uint64_t next_group_id_{0};
+
+    const FrontendCollectorModeDefaultConfig& mode_cfg_;
+    const FrontendCollectorModeSortedConfig& sorted_cfg_;
+    std::chrono::milliseconds wait_timeout_;
+    double time_window_ns_;
+    FrontendEventBuilder builder_;
+    FrontendGroupFinalizer finalizer_;
+    FrontendCoincidenceFilter filter_;
+};
+
+#endif // FRONTEND_COLLECTOR_MODE_SORTED_H
@@ -0,0 +1,65 @@
+#ifndef WAVEFORM_FEATURE_EXTRACTOR_H
+#define WAVEFORM_FEATURE_EXTRACTOR_H
+
+#include "processing/sampic_processing/config/frontend_event_collector_config.h"
+
+#include <cstddef>
+#include <cstdint>
+
+/// Pulse features of one waveform. Times are NaN when the edge is not found.
+struct WaveformFeatures {
+    float baseline = 0.0f;      ///< Mean of the leading baseline_samples (V)
+    float amplitude = 0.0f;     ///< Peak height above/below the baseline, > 0 for a pulse (V)
+    float charge = 0.0f;        ///< Baseline-subtracted integral over the waveform (V·ns)
+    float rise_time_ns = 0.0f;  ///< 10 % to 90 % of the amplitude on the leading edge
+    float cfd_time_ns = 0.0f;   ///< cfd_fraction crossing, relative to the first sample
+    uint16_t peak_index = 0;    ///< Sample of the extremum
+};
+
+/**
+ * @class WaveformFeatureExtractor
+ * @brief Computes WaveformFeatures from corrected SAMPIC samples.
+ *
+ * The O(n) part (sum, minimum and maximum with their positions) runs in an
+ * AVX2 or SSE4.1 kernel when the CPU has it, chosen at runtime, so no
+ * build flags are needed; otherwise a scalar kernel is used. All kernels
+ * accumulate in the same eight lanes in the same order, so results are
+ * bit-identical whichever one runs. The edge times are found by a short
+ * scalar scan back from the peak with linear interpolation.
+ *
+ * extract() is const and may be called from several threads.
+ */
+class WaveformFeatureExtractor {
+public:
+    explicit WaveformFeatureExtractor(const FrontendFeatureExtractionConfig& cfg);
+
+    /** @brief Compute the features of @p n samples. */
+    WaveformFeatures extract(const float* samples, size_t n) const;
+
+    /** @brief Kernel in use. */
+    FrontendFeatureKernel kernel() const { return kernel_; }
+
+    /** @brief True if the CPU can run @p k (AUTO is always supported). */
+    static bool supported(FrontendFeatureKernel k);
+
+    /** @brief Display name of @p k. */
+    static const char* kernelName(FrontendFeatureKernel k);
+
+    /// Per-lane partial results of the O(n) pass.
+    struct Reduction;
+
+private:
+    using ReduceFn = void (*)(const float*, size_t, Reduction&);
+
+    /// Time (in samples) where the leading edge crosses @p level, or NaN.
+    float crossing(const float* s, size_t peak, float baseline, float level) const;
+
+    FrontendFeatureKernel kernel_;
+    ReduceFn reduce_;
+    float dt_ns_;
+    size_t baseline_samples_;
+    float cfd_fraction_;
+    float polarity_;  ///< -1 for negative pulses
+};
+
+#endif // WAVEFORM_FEATURE_EXTRACTOR_H
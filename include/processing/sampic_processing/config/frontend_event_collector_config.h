@@ -1,13 +1,83 @@
 #ifndef FRONTEND_EVENT_COLLECTOR_CONFIG_H
 #define FRONTEND_EVENT_COLLECTOR_CONFIG_H
 
+#include <map>
 #include <string>
 #include <cstdint>
+#include "integration/sampic/config/buffer_overflow_config.h"
 
 /// Available modes for the frontend event collector.
 enum class FrontendCollectorModeType {
     DEFAULT,
-    EXAMPLE
+    EXAMPLE,
+    SORTED,
+    PARALLEL
+};
+
+/// Layout of the waveform/scalar data bank ("AD").
+enum class FrontendDataBankFormat {
+    HITSTRUCT,  ///< Raw HitStruct slices (header + corrected samples); needs keep_event_struct
+    COMPACT,    ///< Column layout from SampicHitTable (see FrontendEventBankCompactData)
+    FEATURES,   ///< Per-hit pulse features only, no samples (see FrontendEventBankFeatures)
+    PACKED      ///< Bit-packed raw ADC codes (see FrontendEventBankPackedData); needs keep_event_struct
+};
+
+/// Instruction set used by the waveform feature kernels.
+enum class FrontendFeatureKernel {
+    AUTO,    ///< Best supported by the CPU
+    SCALAR,
+    SSE41,
+    AVX2
+};
+
+/// Settings for the FEATURES data bank format.
+struct FrontendFeatureExtractionConfig {
+    /// Sampling frequency of the crate (MHz); must match the crate setting.
+    int sampling_frequency_mhz = 6400;
+
+    /// Leading samples averaged for the baseline.
+    int baseline_samples = 8;
+
+    /// Constant-fraction discriminator fraction of the amplitude.
+    float cfd_fraction = 0.5f;
+
+    /// Pulses go below the baseline (SAMPIC default) rather than above it.
+    bool negative_pulses = true;
+
+    /// Kernel selection; AUTO picks AVX2, then SSE4.1, then scalar.
+    FrontendFeatureKernel kernel = FrontendFeatureKernel::AUTO;
+};
+
+/// Compression applied to PACKED data banks.
+enum class FrontendCompressionLevel {
+    NONE,       ///< Plain PACKED bank
+    DELTA,      ///< Codes as residuals from the per-hit baseline, then residual_coding
+    DELTA_LZ4   ///< DELTA, then LZ4 over the whole bank (needs MIDAS built with LZ4)
+};
+
+/// Encoding of the baseline residuals.
+enum class FrontendResidualCoding {
+    BITPACK,  ///< Zigzag, packed at the widest residual of the hit
+    VARINT    ///< Zigzag, LEB128 varint per sample
+};
+
+/// Settings for compressed PACKED data banks (see FrontendEventBankCompressedData).
+struct FrontendCompressionConfig {
+    FrontendCompressionLevel level = FrontendCompressionLevel::NONE;
+    FrontendResidualCoding residual_coding = FrontendResidualCoding::BITPACK;
+
+    /// Compression threads; banks are compressed off the builder's thread.
+    int num_workers = 2;
+
+    /// Banks waiting for a worker before new ones are written uncompressed
+    /// instead, so the builder never waits on the pool.
+    uint32_t max_pending_banks = 256;
+};
+
+/// How pending groups are judged complete.
+enum class FrontendFinalizePolicy {
+    WALL_CLOCK,  ///< Close a group finalize_after_ms after it was opened (host time)
+    WATERMARK    ///< Close a group once every active board's FirstCellTimeStamp has passed its window
 };
 
 /// Configuration for the default frontend collector mode.
@@ -20,12 +90,60 @@ struct FrontendCollectorModeDefaultConfig {
     double time_window_ns = 1000000.0;
 
     /// Maximum time to wait before finalizing a partial event (ms).
+    /// With WATERMARK finalization this only applies while every board is idle.
     double finalize_after_ms = 10.0;
 
+    /// How pending groups are finalized.
+    FrontendFinalizePolicy finalize_policy = FrontendFinalizePolicy::WALL_CLOCK;
+
+    /// WATERMARK: extra hardware-time margin (ns) past t0 + time_window_ns
+    /// before a group is closed, to absorb hits read out slightly out of order.
+    double watermark_margin_ns = 0.0;
+
+    /// WATERMARK: a board with no hits for this long (ms) no longer holds the
+    /// watermark back. Once all boards are idle, finalize_after_ms applies.
+    double board_idle_ms = 100.0;
+
+    /// WATERMARK: number of boards expected to report (indices 0..n-1). Boards
+    /// that have not reported yet hold the watermark back for board_idle_ms
+    /// after the first hit. 0 uses only the boards seen so far.
+    uint32_t watermark_boards = 0;
+
     /// Milliseconds to wait for new SAMPIC events before timing out
     /// (used in the blocking wait inside the mode).
     uint32_t wait_timeout_ms = 1000;
 
+    /// Layout of the data bank.
+    FrontendDataBankFormat data_bank_format = FrontendDataBankFormat::HITSTRUCT;
+
+    /// Feature extraction settings (FEATURES format only).
+    FrontendFeatureExtractionConfig features;
+
+    /// PACKED: minimum bits per ADC code; set to the crate's adc_bits.
+    /// Hits with wider codes are stored at the width they need.
+    int packed_sample_bits = 11;
+
+    /// PACKED: optional compression of the data bank.
+    FrontendCompressionConfig compression;
+
+    // ------------------------------------------------------------------
+    // Event arena
+    // ------------------------------------------------------------------
+
+    /// Carve each cycle's FrontendEvents and banks from a recycled arena
+    /// block instead of the global heap.
+    bool use_event_arena = true;
+
+    /// Arena blocks. A block stays in use until every event built from it
+    /// has been read out (the FrontendEventBuffer releases events as soon
+    /// as its readers have them), so this should cover the readout backlog
+    /// in cycles; when all are taken, cycles fall back to the heap (counted
+    /// as exhausted).
+    uint32_t event_arena_blocks = 64;
+
+    /// Size of one arena block (KB); larger cycles spill to the heap.
+    uint32_t event_arena_block_kb = 256;
+
     // ------------------------------------------------------------------
     // Bank prefixes
     // ------------------------------------------------------------------
@@ -38,6 +156,65 @@ struct FrontendCollectorModeDefaultConfig {
 
     /// Prefix for collector-level timing banks (once per collection loop, e.g. "AC00").
     std::string collector_timing_bank_prefix = "AC";
+
+    /// Prefix for buffer occupancy / drop counter banks (with the collector timing bank, e.g. "AB00").
+    std::string buffer_stats_bank_prefix = "AB";
+
+    /// Prefix for undecoded ML_Frame banks from the RAW SAMPIC collector mode (e.g. "AR00").
+    std::string raw_bank_prefix = "AR";
+
+    /// Prefix for coincidence filter counter banks (with the collector timing bank, e.g. "AF00").
+    std::string filter_stats_bank_prefix = "AF";
+
+    /// Prefix for data bank compression counter banks (with the collector timing bank, e.g. "AZ00").
+    std::string compression_stats_bank_prefix = "AZ";
+};
+
+/// Configuration for the time-sorted sweep mode. Time window, finalization,
+/// data bank format and bank prefixes are taken from default_mode so both
+/// modes produce the same events for the same settings.
+struct FrontendCollectorModeSortedConfig {
+    /// Sort each SampicEvent's hits by FirstCellTimeStamp before merging.
+    /// Only disable if the decoder is known to return hits in time order.
+    bool sort_within_event = true;
+};
+
+/// Configuration for the parallel time-slice mode. It groups exactly as the
+/// sorted mode (whose settings it also uses), spread over a worker pool.
+struct FrontendCollectorModeParallelConfig {
+    /// Worker threads besides the collector thread (total = num_workers + 1)
+    int num_workers = 3;
+
+    /// Smallest time slice handed to one worker, in hits
+    uint32_t min_hits_per_slice = 2048;
+};
+
+/// A set of channels on one board (see FrontendCoincidenceFilterConfig::required_masks).
+/// The 64 channel bits are split in two words so that every bit survives
+/// the ODB, which stores integers as signed INT64.
+struct FrontendChannelMask {
+    uint16_t board = 0;
+    uint32_t channels_lo = 0;  ///< Bit c selects channel c (0-31) of the board
+    uint32_t channels_hi = 0;  ///< Bit c selects channel 32 + c (32-63) of the board
+};
+
+/// Software coincidence trigger, applied by every mode to finalized groups
+/// before their banks are built. Rejected groups are counted and dropped.
+struct FrontendCoincidenceFilterConfig {
+    bool enabled = false;
+
+    /// Minimum number of hits in the group.
+    uint32_t min_hits = 1;
+
+    /// Minimum number of distinct (board, channel) pairs.
+    uint32_t min_channels = 1;
+
+    /// Minimum number of distinct boards.
+    uint32_t min_boards = 1;
+
+    /// Every mask must have at least one of its channels hit. Keyed by a
+    /// free-form name, so that each mask is its own ODB directory.
+    std::map<std::string, FrontendChannelMask> required_masks;
 };
 
 /// Example / placeholder mode configuration.
@@ -54,12 +231,20 @@ struct FrontendEventCollectorConfig {
     /// Buffer size for assembled events.
     uint32_t buffer_size = 512;
 
+    /// What the buffer does when full of events not yet read out.
+    BufferOverflowConfig buffer_overflow;
+
     /// Microseconds to sleep between collection cycles.
     uint32_t sleep_time_us = 1000;
 
+    /// Group selection between finalization and bank creation.
+    FrontendCoincidenceFilterConfig coincidence_filter;
+
     // --- Mode configurations ---
     FrontendCollectorModeDefaultConfig default_mode;
     FrontendCollectorModeExampleConfig example_mode;
+    FrontendCollectorModeSortedConfig sorted_mode;
+    FrontendCollectorModeParallelConfig parallel_mode;
 };
 
 #endif // FRONTEND_EVENT_COLLECTOR_CONFIG_H
@@ -0,0 +1,48 @@
+#ifndef FRONTEND_EVENT_FILE_WRITER_CONFIG_H
+#define FRONTEND_EVENT_FILE_WRITER_CONFIG_H
+
+#include <string>
+#include <cstdint>
+
+/// Settings for FrontendEventFileWriter, which streams FrontendEvents to
+/// local files instead of MIDAS (calibration and stress runs).
+struct FrontendEventFileWriterConfig {
+    /// Write FrontendEvents to files. Run transitions still go through
+    /// MIDAS, but no data events are sent to it unless midas_readout is set.
+    /// Set the collector's buffer_overflow policy to BLOCK so a slow disk
+    /// stalls the collector instead of dropping events.
+    bool enabled = false;
+
+    /// Keep sending FrontendEvents to MIDAS as well; the writer and MIDAS
+    /// readout then each read every event from the FrontendEventBuffer.
+    bool midas_readout = false;
+
+    /// Output directory; must exist.
+    std::string directory = "/data/sampic";
+
+    /// Files are named <file_prefix>_fe<NN>_run<NNNNNN>_<NNNN>.sfe
+    std::string file_prefix = "sampic";
+
+    /// Start a new file once the current one reaches this size (MB); 0 = one file per run.
+    uint32_t max_file_mb = 4096;
+
+    /// Size of each write buffer (MB).
+    uint32_t buffer_mb = 8;
+
+    /// Write buffers: one is filled while the others are written (minimum 2).
+    uint32_t num_buffers = 4;
+
+    /// Open files with O_DIRECT, bypassing the page cache. Falls back to
+    /// buffered I/O on filesystems that refuse it.
+    bool direct_io = true;
+
+    /// Write a partly filled buffer once it is this old (ms), so files stay
+    /// current at low rates.
+    uint32_t flush_interval_ms = 1000;
+
+    /// Write an index file (.sfi) next to each data file, with the offset,
+    /// times, hit count and boards of every FrontendEvent.
+    bool write_index = true;
+};
+
+#endif // FRONTEND_EVENT_FILE_WRITER_CONFIG_H
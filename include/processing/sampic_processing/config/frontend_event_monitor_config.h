@@ -0,0 +1,16 @@
+#ifndef FRONTEND_EVENT_MONITOR_CONFIG_H
+#define FRONTEND_EVENT_MONITOR_CONFIG_H
+
+#include <cstdint>
+
+/// Settings for FrontendEventMonitor, an online rate monitor reading the
+/// FrontendEventBuffer alongside readout.
+struct FrontendEventMonitorConfig {
+    /// Run the monitor. It reads as a DROP consumer, so it never slows readout.
+    bool enabled = false;
+
+    /// Length of one rate interval (ms); a summary is logged after each.
+    uint32_t interval_ms = 1000;
+};
+
+#endif // FRONTEND_EVENT_MONITOR_CONFIG_H
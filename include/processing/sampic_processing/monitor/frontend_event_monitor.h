@@ -0,0 +1,79 @@
+#ifndef FRONTEND_EVENT_MONITOR_H
+#define FRONTEND_EVENT_MONITOR_H
+
+#include "processing/sampic_processing/collector/frontend_event_buffer.h"
+#include "processing/sampic_processing/config/frontend_event_monitor_config.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <cstdint>
+
+/// Rates over the last completed FrontendEventMonitor interval.
+struct FrontendEventMonitorSnapshot {
+    double interval_s = 0.0;
+    double events_per_s = 0.0;
+    double hits_per_s = 0.0;
+    double mb_per_s = 0.0;                    ///< Bank payload
+    std::array<uint64_t, 64> board_events{};  ///< Events with hits on board b (63 = 63 and up)
+    uint64_t missed = 0;                      ///< Events skipped since start() while behind
+};
+
+/**
+ * @class FrontendEventMonitor
+ * @brief Online rate monitor reading the FrontendEventBuffer alongside readout.
+ *
+ * Registers as a DROP consumer, so when it falls behind it skips events
+ * instead of holding them in the buffer; readout and the file writer are
+ * never slowed by it. Each interval it logs event, hit and byte rates and
+ * the boards seen, and keeps them for snapshot().
+ */
+class FrontendEventMonitor {
+public:
+    /**
+     * @param buffer Source of FrontendEvents; must outlive the monitor's run.
+     * @param cfg Monitor settings.
+     */
+    FrontendEventMonitor(FrontendEventBuffer& buffer, const FrontendEventMonitorConfig& cfg);
+
+    /** @brief Stop if still running. */
+    ~FrontendEventMonitor();
+
+    FrontendEventMonitor(const FrontendEventMonitor&) = delete;
+    FrontendEventMonitor& operator=(const FrontendEventMonitor&) = delete;
+
+    /** @brief Register with the buffer and start the monitor thread. */
+    void start();
+
+    /** @brief Stop the thread and unregister. */
+    void stop();
+
+    /** @brief Rates of the last completed interval. */
+    FrontendEventMonitorSnapshot snapshot() const;
+
+private:
+    void loop();
+
+    /// Turn the interval's counts into a snapshot, log it and reset the counts.
+    void publish(std::chrono::steady_clock::duration elapsed);
+
+    FrontendEventBuffer& buffer_;
+    FrontendEventMonitorConfig cfg_;
+    FrontendEventBuffer::ConsumerId consumer_{0};
+
+    // Counts of the current interval (monitor thread only)
+    uint64_t events_{0};
+    uint64_t hits_{0};
+    uint64_t bytes_{0};
+    std::array<uint64_t, 64> board_events_{};
+
+    mutable std::mutex snapshot_mtx_;
+    FrontendEventMonitorSnapshot snapshot_;
+
+    std::thread thread_;
+    std::atomic<bool> running_{false};
+};
+
+#endif // FRONTEND_EVENT_MONITOR_H
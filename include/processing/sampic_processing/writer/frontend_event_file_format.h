@@ -0,0 +1,98 @@
+#ifndef FRONTEND_EVENT_FILE_FORMAT_H
+#define FRONTEND_EVENT_FILE_FORMAT_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @class FrontendEventFileFormat
+ * @brief Layout of the files written by FrontendEventFileWriter.
+ *
+ * Depends only on the standard library so offline code can read the files
+ * without MIDAS. A file is a sequence of frames (little endian), each
+ * starting with a FrameHeader and padded to 8 bytes:
+ *
+ *   FileHeader                       (first frame of every file)
+ *   EventHeader                      (one per FrontendEvent)
+ *     for each bank:
+ *       BankHeader
+ *       uint8_t data[data_size], padded to 8 bytes
+ *   FrameHeader{kPadMagic, size}     (filler up to the writer's I/O
+ *                                     alignment; skip it)
+ *
+ * Bank names and payloads are the ones the same FrontendEvent produces in
+ * a MIDAS event.
+ *
+ * Each data file may have an index file next to it (.sfi instead of .sfe):
+ * an IndexHeader followed by one IndexEntry per FrontendEvent, in file
+ * order. Entries are written as events are serialized, so on a live run the
+ * index can be ahead of the data on disk; check offset + frame_size against
+ * the data file size. See FrontendEventFileIndex for lookups.
+ */
+class FrontendEventFileFormat {
+public:
+    static constexpr uint32_t kFileMagic  = 0x48464653;  ///< "SFFH"
+    static constexpr uint32_t kEventMagic = 0x56454653;  ///< "SFEV"
+    static constexpr uint32_t kPadMagic   = 0x44504653;  ///< "SFPD"
+    static constexpr uint32_t kIndexMagic = 0x58494653;  ///< "SFIX"
+
+    static constexpr uint32_t kVersion = 1;
+
+    /// Frame and bank payload alignment.
+    static constexpr size_t kAlign = 8;
+
+#pragma pack(push, 1)
+    struct FrameHeader {
+        uint32_t magic;
+        uint32_t size;  ///< Whole frame including this header and padding
+    };
+
+    struct FileHeader {
+        FrameHeader frame;
+        uint32_t version;
+        uint32_t frontend_index;
+        int32_t  run_number;
+        uint32_t file_sequence;    ///< 0 for the first file of a run
+        uint64_t created_unix_ns;
+    };
+
+    struct EventHeader {
+        FrameHeader frame;
+        uint64_t sequence;         ///< FrontendEvent number within the run, from 0
+        uint64_t timestamp_ns;     ///< FrontendEvent timestamp (steady clock)
+        uint32_t n_hits;
+        uint32_t n_banks;
+    };
+
+    struct BankHeader {
+        char     name[4];          ///< MIDAS bank name, e.g. "AD00"
+        uint32_t data_size;        ///< Payload bytes, without padding
+    };
+
+    struct IndexHeader {
+        FrameHeader frame;         ///< kIndexMagic; size = sizeof(IndexHeader)
+        uint32_t version;
+        uint32_t frontend_index;
+        int32_t  run_number;
+        uint32_t file_sequence;    ///< Sequence of the data file this index covers
+        uint32_t entry_size;       ///< sizeof(IndexEntry) of the writer
+        uint32_t reserved;
+    };
+
+    struct IndexEntry {
+        uint64_t offset;           ///< Offset of the EventHeader in the data file
+        uint64_t sequence;         ///< EventHeader::sequence
+        uint64_t timestamp_ns;     ///< EventHeader::timestamp_ns
+        double   first_hit_ts;     ///< Earliest FirstCellTimeStamp of the hits (0 if none)
+        double   last_hit_ts;      ///< Latest FirstCellTimeStamp of the hits (0 if none)
+        uint64_t board_mask;       ///< Bit b: board b has hits (boards 63 and up share bit 63)
+        uint32_t n_hits;
+        uint32_t frame_size;       ///< EventHeader::frame.size
+    };
+#pragma pack(pop)
+
+    /** @brief @p n rounded up to kAlign. */
+    static constexpr size_t padded(size_t n) { return (n + kAlign - 1) & ~(kAlign - 1); }
+};
+
+#endif // FRONTEND_EVENT_FILE_FORMAT_H
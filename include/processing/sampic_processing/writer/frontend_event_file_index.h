@@ -0,0 +1,136 @@
+#ifndef FRONTEND_EVENT_FILE_INDEX_H
+#define FRONTEND_EVENT_FILE_INDEX_H
+
+#include "processing/sampic_processing/writer/frontend_event_file_format.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <string>
+#include <vector>
+
+/**
+ * @class FrontendEventFileIndex
+ * @brief Lookups in the index file (.sfi) of one FrontendEventFileWriter data file.
+ *
+ * Header-only and standard-library only, like FrontendEventFileFormat.
+ * Each IndexEntry gives the offset and frame_size of an event, so a
+ * reader can pread() exactly the frames it needs:
+ *
+ *   FrontendEventFileIndex idx;
+ *   if (idx.load(path)) {
+ *       for (const auto* e : idx.findHitTime(t0, t1))
+ *           pread(fd, buf, e->frame_size, e->offset);
+ *   }
+ *
+ * Sequence lookups are binary searches. Hit times are not strictly ordered
+ * across events (groups overlap, and the default mode emits them by
+ * finalization), so findHitTime() searches running extremes of the hit
+ * times and then checks the few candidates in between.
+ */
+class FrontendEventFileIndex {
+public:
+    using Format = FrontendEventFileFormat;
+    using Entry = Format::IndexEntry;
+
+    /**
+     * @brief Read the index at @p path.
+     *
+     * A trailing partial entry (index of a file still being written) is
+     * ignored. Entries written by a newer writer with a larger entry_size
+     * are read up to the fields known here.
+     *
+     * @return False if the file cannot be read or is not an index.
+     */
+    bool load(const std::string& path) {
+        header_ = {};
+        entries_.clear();
+        max_last_.clear();
+        min_first_.clear();
+
+        std::FILE* f = std::fopen(path.c_str(), "rb");
+        if (!f)
+            return false;
+        std::vector<uint8_t> bytes;
+        uint8_t chunk[1 << 16];
+        for (size_t n; (n = std::fread(chunk, 1, sizeof(chunk), f)) > 0;)
+            bytes.insert(bytes.end(), chunk, chunk + n);
+        std::fclose(f);
+
+        if (bytes.size() < sizeof(Format::IndexHeader))
+            return false;
+        std::memcpy(&header_, bytes.data(), sizeof(header_));
+        if (header_.frame.magic != Format::kIndexMagic || header_.entry_size < sizeof(Entry) ||
+            header_.frame.size < sizeof(Format::IndexHeader) || header_.frame.size > bytes.size())
+            return false;
+
+        const size_t stride = header_.entry_size;
+        const size_t n = (bytes.size() - header_.frame.size) / stride;
+        entries_.resize(n);
+        for (size_t i = 0; i < n; ++i)
+            std::memcpy(&entries_[i], bytes.data() + header_.frame.size + i * stride, sizeof(Entry));
+
+        // Running max of last_hit_ts from the front and min of first_hit_ts
+        // from the back; both are monotonic, so findHitTime() can bisect them.
+        // Events without hits take no part.
+        constexpr double inf = std::numeric_limits<double>::infinity();
+        max_last_.resize(n);
+        min_first_.resize(n);
+        double hi = -inf;
+        for (size_t i = 0; i < n; ++i) {
+            if (entries_[i].n_hits > 0)
+                hi = std::max(hi, entries_[i].last_hit_ts);
+            max_last_[i] = hi;
+        }
+        double lo = inf;
+        for (size_t i = n; i-- > 0;) {
+            if (entries_[i].n_hits > 0)
+                lo = std::min(lo, entries_[i].first_hit_ts);
+            min_first_[i] = lo;
+        }
+        return true;
+    }
+
+    const Format::IndexHeader& header() const { return header_; }
+    std::span<const Entry> entries() const { return entries_; }
+    size_t size() const { return entries_.size(); }
+    bool empty() const { return entries_.empty(); }
+
+    /** @brief Entry of the FrontendEvent with @p sequence, or nullptr if not in this file. */
+    const Entry* findSequence(uint64_t sequence) const {
+        auto it = std::lower_bound(entries_.begin(), entries_.end(), sequence,
+                                   [](const Entry& e, uint64_t s) { return e.sequence < s; });
+        return it != entries_.end() && it->sequence == sequence ? &*it : nullptr;
+    }
+
+    /**
+     * @brief Entries whose hits overlap [@p t_begin, @p t_end] (FirstCellTimeStamp),
+     *        in file order.
+     */
+    std::vector<const Entry*> findHitTime(double t_begin, double t_end) const {
+        std::vector<const Entry*> out;
+        // First event that could reach t_begin, first that must start after t_end
+        const size_t lo = static_cast<size_t>(
+            std::partition_point(max_last_.begin(), max_last_.end(),
+                                 [t_begin](double t) { return t < t_begin; }) - max_last_.begin());
+        const size_t hi = static_cast<size_t>(
+            std::partition_point(min_first_.begin(), min_first_.end(),
+                                 [t_end](double t) { return t <= t_end; }) - min_first_.begin());
+        for (size_t i = lo; i < hi; ++i) {
+            const Entry& e = entries_[i];
+            if (e.n_hits > 0 && e.last_hit_ts >= t_begin && e.first_hit_ts <= t_end)
+                out.push_back(&e);
+        }
+        return out;
+    }
+
+private:
+    Format::IndexHeader header_{};
+    std::vector<Entry> entries_;
+    std::vector<double> max_last_;   ///< max(last_hit_ts) over entries [0, i]
+    std::vector<double> min_first_;  ///< min(first_hit_ts) over entries [i, n)
+};
+
+#endif // FRONTEND_EVENT_FILE_INDEX_H
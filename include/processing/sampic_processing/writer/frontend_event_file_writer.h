@@ -0,0 +1,177 @@
+#ifndef FRONTEND_EVENT_FILE_WRITER_H
+#define FRONTEND_EVENT_FILE_WRITER_H
+
+#include "processing/sampic_processing/collector/frontend_event_buffer.h"
+#include "processing/sampic_processing/config/frontend_event_file_writer_config.h"
+#include "processing/sampic_processing/writer/frontend_event_file_format.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdint>
+
+/// Counters of one FrontendEventFileWriter run.
+struct FrontendEventFileWriterStats {
+    uint64_t events = 0;        ///< FrontendEvents written
+    uint64_t bytes = 0;         ///< Bytes written to disk, padding included
+    uint64_t files = 0;         ///< Files opened
+    uint64_t buffer_waits = 0;  ///< Times serialization waited for a free buffer (disk behind)
+    uint64_t write_errors = 0;  ///< Buffers lost to open/write failures
+    uint64_t index_errors = 0;  ///< Index entries lost to open/write failures
+};
+
+/**
+ * @class FrontendEventFileWriter
+ * @brief Streams FrontendEvents from a FrontendEventBuffer to local files.
+ *
+ * An alternative to MIDAS readout for runs where the MIDAS event buffer
+ * and logger, not the crate, limit the rate. Two threads cooperate:
+ *
+ *  - the serializer waits on the FrontendEventBuffer and frames each
+ *    FrontendEvent (see FrontendEventFileFormat) into the current write
+ *    buffer, handing it over when full or flush_interval_ms old;
+ *  - the I/O thread writes filled buffers in large aligned writes, with
+ *    O_DIRECT where the filesystem allows it, and rotates files by size.
+ *
+ * With write_index, the serializer also appends an IndexEntry per event to
+ * an index file next to each data file, so readers can seek by event
+ * number or hit time without scanning the data.
+ *
+ * With num_buffers buffers, serialization continues while the others are
+ * on their way to disk. The writer reads the FrontendEventBuffer as a BLOCK
+ * consumer: if the disk falls behind, the serializer waits for a buffer and
+ * events back up in the FrontendEventBuffer, whose overflow policy decides
+ * what happens; the collector never waits on the writer unless that policy
+ * is BLOCK. Under DROP_OLDEST or DROP_NEWEST events are lost once the buffer
+ * fills and show up as missed in the writer's consumerStats(); the frontend
+ * warns at begin of run when the writer is enabled without BLOCK.
+ */
+class FrontendEventFileWriter {
+public:
+    /**
+     * @param buffer Source of FrontendEvents; must outlive the writer's run.
+     * @param cfg Writer settings.
+     * @param frontend_index MIDAS frontend index, used in bank and file names.
+     */
+    FrontendEventFileWriter(FrontendEventBuffer& buffer,
+                            const FrontendEventFileWriterConfig& cfg,
+                            int frontend_index);
+
+    /** @brief Stop (writing out what is buffered) if still running. */
+    ~FrontendEventFileWriter();
+
+    FrontendEventFileWriter(const FrontendEventFileWriter&) = delete;
+    FrontendEventFileWriter& operator=(const FrontendEventFileWriter&) = delete;
+
+    /**
+     * @brief Open the first file of @p run_number and start the threads.
+     * @return False if the file could not be opened.
+     */
+    bool start(int run_number);
+
+    /** @brief Write out the events still in the FrontendEventBuffer, then close the file. */
+    void stop();
+
+    bool running() const { return running_; }
+
+    /** @brief Counters since start(). */
+    FrontendEventFileWriterStats stats() const;
+
+    /** @brief Path of the file @p seq of @p run_number. */
+    std::string filePath(int run_number, uint32_t seq) const;
+
+    /** @brief Path of the index of file @p seq of @p run_number. */
+    std::string indexPath(int run_number, uint32_t seq) const;
+
+private:
+    using Format = FrontendEventFileFormat;
+
+    /// Alignment of every write (and of O_DIRECT buffers and offsets).
+    static constexpr size_t kIoAlign = 4096;
+
+    struct WriteBuffer {
+        uint8_t* data{nullptr};
+        size_t capacity{0};
+        size_t used{0};
+        bool close_file{false};  ///< Last buffer of the current file
+        bool oversize{false};    ///< One-off buffer for a single large event, freed after writing
+    };
+
+    void serializeLoop();
+    void ioLoop();
+
+    void drain();
+    void appendEvent(const FrontendEvent& fev);
+    void appendFileHeader();
+    void appendIndexEntry(const Format::EventHeader& eh, uint64_t offset, const FrontendEvent& fev);
+
+    /// Reserve @p n bytes in the current buffer, handing it over first if it is too full.
+    uint8_t* reserve(size_t n);
+
+    /// Pad the current buffer to kIoAlign and queue it for the I/O thread.
+    void submitCurrent(bool close_file);
+
+    WriteBuffer* takeFreeBuffer();
+    void releaseBuffer(WriteBuffer* buf);
+
+    bool openFile(uint32_t seq);
+    void closeFile();
+    bool writeAll(const uint8_t* data, size_t len);
+
+    void openIndex(uint32_t seq);
+    void closeIndex();
+    void indexError();
+
+    std::string basePath(int run_number, uint32_t seq) const;
+
+    FrontendEventBuffer& buffer_;
+    FrontendEventFileWriterConfig cfg_;
+    int frontend_index_;
+    char bank_suffix_[3];
+    size_t buffer_bytes_;
+    uint64_t max_file_bytes_;
+
+    std::vector<WriteBuffer> buffers_;
+
+    // Serializer state
+    FrontendEventBuffer::ConsumerId consumer_{0};
+    WriteBuffer* current_{nullptr};
+    std::chrono::steady_clock::time_point current_since_;
+    uint64_t file_bytes_{0};
+    uint32_t file_seq_{0};
+    uint64_t event_seq_{0};
+    int run_number_{0};
+    std::FILE* index_{nullptr};  ///< Index of the file being serialized, if enabled
+
+    // Hand-over between the threads
+    std::mutex mtx_;
+    std::condition_variable free_cv_;
+    std::condition_variable filled_cv_;
+    std::vector<WriteBuffer*> free_;
+    std::deque<WriteBuffer*> filled_;
+    bool io_done_{false};  ///< Serializer finished; I/O thread exits once filled_ is empty
+
+    // I/O thread state
+    int fd_{-1};
+    uint32_t io_file_seq_{0};
+    bool warned_no_direct_{false};
+
+    std::thread serializer_;
+    std::thread io_;
+    std::atomic<bool> running_{false};
+
+    std::atomic<uint64_t> events_{0};
+    std::atomic<uint64_t> bytes_{0};
+    std::atomic<uint64_t> files_{0};
+    std::atomic<uint64_t> buffer_waits_{0};
+    std::atomic<uint64_t> write_errors_{0};
+    std::atomic<uint64_t> index_errors_{0};
+};
+
+#endif // FRONTEND_EVENT_FILE_WRITER_H
@@ -0,0 +1,239 @@
+// ============================================================================
+// frontend_grouping_benchmark
+//
+// Measures FrontendEventCollector grouping throughput (hits/s) as a function
+// of the number of groups open at once, for each frontend collector mode.
+// Synthetic SampicEvents are generated outside the timed region; only
+// collect() (merge/group, finalize, bank building, publish) is timed.
+// No hardware or MIDAS is needed.
+// ============================================================================
+
+#include "integration/sampic/collector/buffers/sampic_event_buffer_default.h"
+#include "processing/sampic_processing/collector/frontend_event_buffer.h"
+#include "processing/sampic_processing/collector/modes/frontend_collector_mode_default.h"
+#include "processing/sampic_processing/collector/modes/frontend_collector_mode_sorted.h"
+#include "processing/sampic_processing/collector/modes/frontend_collector_mode_parallel.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+/// Number of HitStruct slots in one EventStruct.
+constexpr int kEventCapacity = static_cast<int>(sizeof(EventStruct::Hit) / sizeof(HitStruct));
+
+struct Options {
+    std::vector<int> groups{1, 10, 100, 1000, 10000};
+    std::vector<std::string> modes{"default", "sorted", "parallel"};
+    int hits_per_event = 256;
+    int events_per_cycle = 8;
+    int cycles = 50;
+    int samples = 64;
+    double window_ns = 100.0;
+    int workers = 3;
+    bool shuffle_within_event = true;
+};
+
+void showHelp(const char* argv0) {
+    std::printf(
+        "Usage: %s [OPTIONS]\n"
+        "\n"
+        "Options:\n"
+        "  -g, --groups <list>        Open-group counts to test (default: 1,10,100,1000,10000)\n"
+        "  -m, --modes <list>         Modes to compare: default,sorted,parallel (default: all)\n"
+        "  -n, --hits-per-event <n>   Hits per SampicEvent (default: 256)\n"
+        "  -e, --events <n>           SampicEvents per collect() cycle (default: 8)\n"
+        "  -c, --cycles <n>           Timed cycles per point (default: 50)\n"
+        "  -s, --samples <n>          Samples per hit (default: 64)\n"
+        "  -w, --window-ns <ns>       Grouping time window (default: 100)\n"
+        "  -t, --workers <n>          Worker threads for the parallel mode (default: 3)\n"
+        "      --time-ordered         Generate hits already time-ordered within each event\n"
+        "  -h, --help                 Display this help message\n",
+        argv0);
+}
+
+template <typename T>
+std::vector<T> parseList(const std::string& s) {
+    std::vector<T> out;
+    std::stringstream ss(s);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        std::stringstream is(item);
+        T v{};
+        is >> v;
+        out.push_back(v);
+    }
+    return out;
+}
+
+bool parseArgs(int argc, char** argv, Options& opt) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string a = argv[i];
+        const bool has_value = i + 1 < argc;
+        if (a == "-h" || a == "--help") {
+            showHelp(argv[0]);
+            std::exit(0);
+        } else if ((a == "-g" || a == "--groups") && has_value) {
+            opt.groups = parseList<int>(argv[++i]);
+        } else if ((a == "-m" || a == "--modes") && has_value) {
+            opt.modes = parseList<std::string>(argv[++i]);
+        } else if ((a == "-n" || a == "--hits-per-event") && has_value) {
+            opt.hits_per_event = std::atoi(argv[++i]);
+        } else if ((a == "-e" || a == "--events") && has_value) {
+            opt.events_per_cycle = std::atoi(argv[++i]);
+        } else if ((a == "-c" || a == "--cycles") && has_value) {
+            opt.cycles = std::atoi(argv[++i]);
+        } else if ((a == "-s" || a == "--samples") && has_value) {
+            opt.samples = std::atoi(argv[++i]);
+        } else if ((a == "-w" || a == "--window-ns") && has_value) {
+            opt.window_ns = std::atof(argv[++i]);
+        } else if ((a == "-t" || a == "--workers") && has_value) {
+            opt.workers = std::atoi(argv[++i]);
+        } else if (a == "--time-ordered") {
+            opt.shuffle_within_event = false;
+        } else {
+            spdlog::error("Unknown option or missing value: {}", a);
+            showHelp(argv[0]);
+            return false;
+        }
+    }
+    opt.hits_per_event = std::clamp(opt.hits_per_event, 1, kEventCapacity);
+    return true;
+}
+
+/**
+ * @brief Synthetic hit source: each cycle spreads its hits over @p groups
+ *        clusters spaced 4 windows apart, so that exactly @p groups groups
+ *        are built per cycle.
+ */
+class Generator {
+public:
+    Generator(const Options& opt, int groups)
+        : opt_(opt), groups_(groups), gen_(12345), ev_(std::make_unique<EventStruct>()) {}
+
+    std::vector<std::shared_ptr<SampicEvent>> cycle() {
+        const double spacing = 4.0 * opt_.window_ns;
+        std::uniform_int_distribution<int> cluster(0, groups_ - 1);
+        std::uniform_real_distribution<double> jitter(-opt_.window_ns / 4, opt_.window_ns / 4);
+
+        std::vector<std::shared_ptr<SampicEvent>> events;
+        for (int e = 0; e < opt_.events_per_cycle; ++e) {
+            std::vector<double> ts(opt_.hits_per_event);
+            for (double& t : ts)
+                t = base_ns_ + cluster(gen_) * spacing + jitter(gen_);
+            if (!opt_.shuffle_within_event)
+                std::sort(ts.begin(), ts.end());
+
+            ev_->NbOfHitsInEvent = opt_.hits_per_event;
+            for (int i = 0; i < opt_.hits_per_event; ++i) {
+                HitStruct& h = ev_->Hit[i];
+                h.Channel = i % 64;
+                h.HitNumber = hit_number_++;
+                h.DataSize = opt_.samples;
+                h.FirstCellTimeStamp = ts[i];
+                h.TimeInstant = ts[i];
+            }
+            events.push_back(std::make_shared<SampicEvent>(
+                nullptr, std::make_shared<const SampicHitTable>(*ev_),
+                SampicTimingBreakdown{}, std::chrono::steady_clock::now()));
+        }
+        base_ns_ += (groups_ + 1) * spacing * 2;
+        return events;
+    }
+
+private:
+    const Options& opt_;
+    int groups_;
+    std::mt19937 gen_;
+    std::unique_ptr<EventStruct> ev_;
+    double base_ns_{0.0};
+    int hit_number_{0};
+};
+
+struct Result {
+    double hits_per_s = 0;
+    double collect_us = 0;
+    double events_per_cycle = 0;
+};
+
+Result run(const Options& opt, const std::string& mode, int groups) {
+    FrontendEventCollectorConfig cfg;
+    cfg.default_mode.time_window_ns = opt.window_ns;
+    cfg.default_mode.finalize_after_ms = 0;
+    cfg.default_mode.wait_timeout_ms = 0;
+    cfg.default_mode.data_bank_format = FrontendDataBankFormat::COMPACT;
+    cfg.parallel_mode.num_workers = opt.workers;
+
+    SampicEventBufferDefault sampic_buffer(static_cast<size_t>(opt.events_per_cycle) * 4);
+    FrontendEventBuffer frontend_buffer(static_cast<size_t>(groups) * 4 + 64);
+
+    std::unique_ptr<FrontendCollectorMode> m;
+    if (mode == "sorted")
+        m = std::make_unique<FrontendCollectorModeSorted>(sampic_buffer, frontend_buffer, cfg);
+    else if (mode == "parallel")
+        m = std::make_unique<FrontendCollectorModeParallel>(sampic_buffer, frontend_buffer, cfg);
+    else
+        m = std::make_unique<FrontendCollectorModeDefault>(sampic_buffer, frontend_buffer, cfg);
+
+    Generator gen(opt, groups);
+    uint64_t fe_cursor = 0;
+    uint64_t emitted = 0;
+    double busy_s = 0;
+
+    // One untimed warm-up cycle, so steady-state cycles also finalize the previous one
+    for (int c = -1; c < opt.cycles; ++c) {
+        for (auto& ev : gen.cycle())
+            sampic_buffer.push(ev);
+
+        const auto t0 = std::chrono::steady_clock::now();
+        m->collect();
+        const auto t1 = std::chrono::steady_clock::now();
+
+        const size_t n = frontend_buffer.getSince(fe_cursor).size();
+        if (c >= 0) {
+            busy_s += std::chrono::duration<double>(t1 - t0).count();
+            emitted += n;
+        }
+    }
+
+    const double hits = static_cast<double>(opt.cycles) * opt.events_per_cycle * opt.hits_per_event;
+    Result r;
+    r.hits_per_s = busy_s > 0 ? hits / busy_s : 0;
+    r.collect_us = busy_s * 1e6 / opt.cycles;
+    r.events_per_cycle = static_cast<double>(emitted) / opt.cycles;
+    return r;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parseArgs(argc, argv, opt))
+        return 1;
+
+    spdlog::set_level(spdlog::level::warn);
+
+    std::printf("hits/cycle=%d (%d events x %d hits), samples=%d, window=%.0f ns, %s within event\n\n",
+                opt.events_per_cycle * opt.hits_per_event, opt.events_per_cycle, opt.hits_per_event,
+                opt.samples, opt.window_ns, opt.shuffle_within_event ? "unordered" : "time-ordered");
+    std::printf("%-10s %12s %14s %14s %16s\n", "mode", "open_groups", "hits/s", "collect_us", "events/cycle");
+
+    for (const auto& mode : opt.modes) {
+        for (int g : opt.groups) {
+            const Result r = run(opt, mode, std::max(1, g));
+            std::printf("%-10s %12d %14.3e %14.1f %16.1f\n",
+                        mode.c_str(), g, r.hits_per_s, r.collect_us, r.events_per_cycle);
+            std::fflush(stdout);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,701 @@
+#ifndef SAMPIC_MIDAS_READER_H
+#define SAMPIC_MIDAS_READER_H
+
+// ============================================================================
+// sampic_midas_reader.h
+//
+// Header-only reader for MIDAS files written by the SAMPIC frontend. Files
+// are memory-mapped and walked in place: events, banks, AD hits and AT/AC
+// records are views into the mapping, nothing is copied until a field is
+// read. Needs only the standard library, POSIX, the SAMPIC type header and
+// the frontend's bank headers (no libmidas, no spdlog).
+//
+//   sampic::MidasFile f("run00042.mid");
+//   for (const sampic::MidasEventView& ev : f.events()) {
+//       sampic::forEachFrontendEvent(ev, [](const sampic::FrontendEventBanks& fe) {
+//           if (auto ad = fe.find("AD"))
+//               for (sampic::AdHitView hit : sampic::AdBankView(ad->data)) ...
+//           if (auto at = fe.find("AT"))
+//               if (auto rec = at->record<sampic::EventTimingRecord>()) ...
+//       });
+//   }
+//
+// sampic::parallelScan() runs the same walk over many files on a thread
+// pool. Only uncompressed .mid files are supported; decompress .mid.gz or
+// .mid.lz4 first. AD banks are read in the HITSTRUCT layout; COMPACT,
+// FEATURES and PACKED banks are available as raw bytes.
+// ============================================================================
+
+#include "processing/sampic_processing/collector/banks/frontend_event_bank_event_timing.h"
+#include "processing/sampic_processing/collector/banks/frontend_event_bank_collector_timing.h"
+
+extern "C" {
+#include <SAMPIC_256Ch_Type.h>
+}
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace sampic {
+
+using EventTimingRecord = FrontendEventBankEventTiming::Record;
+using CollectorTimingRecord = FrontendEventBankCollectorTiming::Record;
+
+namespace detail {
+
+/// Unaligned little-endian load; MIDAS only guarantees 8-byte payload alignment
+/// relative to the event, not the file mapping.
+template <typename T>
+inline T load(const uint8_t* p) {
+    T v;
+    std::memcpy(&v, p, sizeof(T));
+    return v;
+}
+
+constexpr size_t align8(size_t n) { return (n + 7) & ~size_t{7}; }
+
+} // namespace detail
+
+/// Constants of the MIDAS event and bank layout (midas.h).
+struct MidasFormat {
+    static constexpr size_t kEventHeaderBytes = 16;  ///< EVENT_HEADER
+    static constexpr size_t kBankHeaderBytes = 8;    ///< BANK_HEADER
+
+    static constexpr uint32_t kBank32 = 1u << 4;           ///< BANK_FORMAT_32BIT
+    static constexpr uint32_t kBank64Aligned = 1u << 5;    ///< BANK_FORMAT_64BIT_ALIGNED
+
+    /// Event ids from here up are run transitions and messages (BOR/EOR/MSG).
+    static constexpr uint16_t kFirstSpecialId = 0x8000;
+};
+
+// ============================================================================
+// Banks
+// ============================================================================
+
+/// One bank of a MIDAS event. Data points into the file mapping.
+struct MidasBankView {
+    char name_chars[4]{};
+    uint32_t type = 0;                ///< MIDAS TID_* of the payload
+    std::span<const uint8_t> data;
+
+    std::string_view name() const { return {name_chars, 4}; }
+
+    /** @brief Whether the bank name starts with @p prefix (e.g. "AD" for "AD00"). */
+    bool hasPrefix(std::string_view prefix) const {
+        return prefix.size() <= 4 && name().substr(0, prefix.size()) == prefix;
+    }
+
+    /**
+     * @brief Copy the payload into a fixed-size record (AT, AC, ...).
+     * @return Empty if the payload size does not match @p Record.
+     */
+    template <typename Record>
+    std::optional<Record> record() const {
+        if (data.size() != sizeof(Record))
+            return std::nullopt;
+        Record r;
+        std::memcpy(&r, data.data(), sizeof(Record));
+        return r;
+    }
+};
+
+/// Forward iterator over the banks of one event (BANK, BANK32 or BANK32A).
+class MidasBankIterator {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = MidasBankView;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const MidasBankView*;
+    using reference = const MidasBankView&;
+
+    MidasBankIterator() = default;
+
+    /// @param header_bytes 8 (BANK), 12 (BANK32) or 16 (BANK32A).
+    MidasBankIterator(const uint8_t* pos, const uint8_t* end, size_t header_bytes)
+        : pos_(pos), end_(end), header_bytes_(header_bytes) { load(); }
+
+    reference operator*() const { return bank_; }
+    pointer operator->() const { return &bank_; }
+
+    MidasBankIterator& operator++() {
+        pos_ = bank_.data.data() + detail::align8(bank_.data.size());
+        if (pos_ > end_) pos_ = end_;
+        load();
+        return *this;
+    }
+
+    MidasBankIterator operator++(int) {
+        MidasBankIterator old = *this;
+        ++*this;
+        return old;
+    }
+
+    bool operator==(const MidasBankIterator& o) const { return pos_ == o.pos_; }
+
+private:
+    void load() {
+        if (!pos_ || static_cast<size_t>(end_ - pos_) < header_bytes_) {
+            pos_ = end_;
+            return;
+        }
+        std::memcpy(bank_.name_chars, pos_, 4);
+        size_t size;
+        if (header_bytes_ == 8) {
+            bank_.type = detail::load<uint16_t>(pos_ + 4);
+            size = detail::load<uint16_t>(pos_ + 6);
+        } else {
+            bank_.type = detail::load<uint32_t>(pos_ + 4);
+            size = detail::load<uint32_t>(pos_ + 8);
+        }
+        const uint8_t* payload = pos_ + header_bytes_;
+        if (size > static_cast<size_t>(end_ - payload)) {
+            pos_ = end_;  // Truncated bank: stop here
+            return;
+        }
+        bank_.data = {payload, size};
+    }
+
+    const uint8_t* pos_ = nullptr;
+    const uint8_t* end_ = nullptr;
+    size_t header_bytes_ = 8;
+    MidasBankView bank_;
+};
+
+/// A run of banks [begin, end) within one event.
+class MidasBankRange {
+public:
+    MidasBankRange() = default;
+    MidasBankRange(MidasBankIterator b, MidasBankIterator e) : begin_(b), end_(e) {}
+
+    MidasBankIterator begin() const { return begin_; }
+    MidasBankIterator end() const { return end_; }
+    bool empty() const { return begin_ == end_; }
+
+    /** @brief First bank whose name starts with @p prefix. */
+    std::optional<MidasBankView> find(std::string_view prefix) const {
+        for (const MidasBankView& b : *this)
+            if (b.hasPrefix(prefix))
+                return b;
+        return std::nullopt;
+    }
+
+private:
+    MidasBankIterator begin_;
+    MidasBankIterator end_;
+};
+
+// ============================================================================
+// Events
+// ============================================================================
+
+/// One MIDAS event. Data (everything after EVENT_HEADER) points into the mapping.
+struct MidasEventView {
+    uint16_t event_id = 0;
+    uint16_t trigger_mask = 0;
+    uint32_t serial_number = 0;
+    uint32_t time_stamp = 0;            ///< Unix seconds
+    uint64_t file_offset = 0;           ///< Offset of the EVENT_HEADER in the file
+    std::span<const uint8_t> data;
+
+    /** @brief Run transition or message event (ODB dump, no banks). */
+    bool isSpecial() const { return event_id >= MidasFormat::kFirstSpecialId; }
+
+    /** @brief The event's banks; empty for special events. */
+    MidasBankRange banks() const {
+        if (isSpecial() || data.size() < MidasFormat::kBankHeaderBytes)
+            return {};
+        const uint32_t bank_bytes = detail::load<uint32_t>(data.data());
+        const uint32_t flags = detail::load<uint32_t>(data.data() + 4);
+        const size_t header_bytes = (flags & MidasFormat::kBank64Aligned) ? 16
+                                  : (flags & MidasFormat::kBank32)        ? 12
+                                  : 8;
+        const uint8_t* first = data.data() + MidasFormat::kBankHeaderBytes;
+        const uint8_t* end = first + std::min<size_t>(bank_bytes, data.size() - MidasFormat::kBankHeaderBytes);
+        return {MidasBankIterator(first, end, header_bytes), MidasBankIterator(end, end, header_bytes)};
+    }
+
+    std::optional<MidasBankView> findBank(std::string_view prefix) const { return banks().find(prefix); }
+};
+
+/// Forward iterator over the events of a byte range of a mapped file.
+class MidasEventIterator {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = MidasEventView;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const MidasEventView*;
+    using reference = const MidasEventView&;
+
+    MidasEventIterator() = default;
+
+    /// @param base Start of the file mapping (for file_offset).
+    /// @param stop No event starting at or after @p stop is visited (defaults to @p end).
+    MidasEventIterator(const uint8_t* base, const uint8_t* pos, const uint8_t* end,
+                       const uint8_t* stop = nullptr)
+        : base_(base), pos_(pos), end_(end), stop_(stop ? stop : end) { load(); }
+
+    reference operator*() const { return event_; }
+    pointer operator->() const { return &event_; }
+
+    MidasEventIterator& operator++() {
+        pos_ = event_.data.data() + event_.data.size();
+        load();
+        return *this;
+    }
+
+    MidasEventIterator operator++(int) {
+        MidasEventIterator old = *this;
+        ++*this;
+        return old;
+    }
+
+    bool operator==(const MidasEventIterator& o) const { return pos_ == o.pos_; }
+
+private:
+    void load() {
+        if (!pos_ || pos_ >= stop_ || static_cast<size_t>(end_ - pos_) < MidasFormat::kEventHeaderBytes) {
+            pos_ = end_;
+            return;
+        }
+        const uint32_t size = detail::load<uint32_t>(pos_ + 12);
+        const uint8_t* payload = pos_ + MidasFormat::kEventHeaderBytes;
+        if (size > static_cast<size_t>(end_ - payload)) {
+            pos_ = end_;  // Truncated event (file still being written): stop here
+            return;
+        }
+        event_.event_id = detail::load<uint16_t>(pos_);
+        event_.trigger_mask = detail::load<uint16_t>(pos_ + 2);
+        event_.serial_number = detail::load<uint32_t>(pos_ + 4);
+        event_.time_stamp = detail::load<uint32_t>(pos_ + 8);
+        event_.file_offset = static_cast<uint64_t>(pos_ - base_);
+        event_.data = {payload, size};
+    }
+
+    const uint8_t* base_ = nullptr;
+    const uint8_t* pos_ = nullptr;
+    const uint8_t* end_ = nullptr;
+    const uint8_t* stop_ = nullptr;
+    MidasEventView event_;
+};
+
+/// A run of events [begin, end) of one file.
+class MidasEventRange {
+public:
+    MidasEventRange() = default;
+    MidasEventRange(MidasEventIterator b, MidasEventIterator e) : begin_(b), end_(e) {}
+
+    MidasEventIterator begin() const { return begin_; }
+    MidasEventIterator end() const { return end_; }
+
+private:
+    MidasEventIterator begin_;
+    MidasEventIterator end_;
+};
+
+// ============================================================================
+// File
+// ============================================================================
+
+/**
+ * @class MidasFile
+ * @brief Read-only memory mapping of one uncompressed MIDAS file.
+ *
+ * Views handed out by events() stay valid as long as the MidasFile.
+ * Throws std::runtime_error if the file cannot be opened or is compressed.
+ */
+class MidasFile {
+public:
+    explicit MidasFile(std::string path) : path_(std::move(path)) {
+        const int fd = ::open(path_.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+            throw std::runtime_error("MidasFile: cannot open " + path_ + ": " + std::strerror(errno));
+        struct stat st{};
+        if (::fstat(fd, &st) != 0) {
+            const int err = errno;
+            ::close(fd);
+            throw std::runtime_error("MidasFile: cannot stat " + path_ + ": " + std::strerror(err));
+        }
+        size_ = static_cast<size_t>(st.st_size);
+        if (size_ > 0) {
+            void* p = ::mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+            if (p == MAP_FAILED) {
+                const int err = errno;
+                ::close(fd);
+                throw std::runtime_error("MidasFile: cannot map " + path_ + ": " + std::strerror(err));
+            }
+            data_ = static_cast<const uint8_t*>(p);
+        }
+        ::close(fd);
+
+        if (size_ >= 4) {
+            const uint32_t magic = detail::load<uint32_t>(data_);
+            if ((magic & 0xffff) == 0x8b1f || magic == 0x184d2204) {
+                unmap();
+                throw std::runtime_error("MidasFile: " + path_ + " is compressed (gzip/lz4); decompress it first");
+            }
+        }
+    }
+
+    ~MidasFile() { unmap(); }
+
+    MidasFile(const MidasFile&) = delete;
+    MidasFile& operator=(const MidasFile&) = delete;
+
+    MidasFile(MidasFile&& o) noexcept
+        : path_(std::move(o.path_)), data_(std::exchange(o.data_, nullptr)), size_(std::exchange(o.size_, 0)) {}
+
+    MidasFile& operator=(MidasFile&& o) noexcept {
+        if (this != &o) {
+            unmap();
+            path_ = std::move(o.path_);
+            data_ = std::exchange(o.data_, nullptr);
+            size_ = std::exchange(o.size_, 0);
+        }
+        return *this;
+    }
+
+    const std::string& path() const { return path_; }
+    size_t size() const { return size_; }
+    std::span<const uint8_t> bytes() const { return {data_, size_}; }
+
+    /** @brief All events of the file. */
+    MidasEventRange events() const { return events(0, size_); }
+
+    /**
+     * @brief Events starting in [@p begin_offset, @p end_offset).
+     *
+     * @p begin_offset must be the offset of an event header (0 or a
+     * file_offset seen before); the last event may extend past @p end_offset.
+     */
+    MidasEventRange events(uint64_t begin_offset, uint64_t end_offset) const {
+        begin_offset = std::min<uint64_t>(begin_offset, size_);
+        end_offset = std::min<uint64_t>(end_offset, size_);
+        const uint8_t* end = data_ + size_;
+        return {MidasEventIterator(data_, data_ + begin_offset, end, data_ + end_offset),
+                MidasEventIterator(data_, end, end)};
+    }
+
+    /**
+     * @brief Split the file at event boundaries into pieces of about @p chunk_bytes.
+     * @return Offsets of the first event of each piece; the last piece ends at size().
+     */
+    std::vector<uint64_t> chunkOffsets(size_t chunk_bytes) const {
+        std::vector<uint64_t> offsets;
+        uint64_t next = 0;
+        for (const MidasEventView& ev : events()) {
+            if (ev.file_offset >= next) {
+                offsets.push_back(ev.file_offset);
+                next = ev.file_offset + std::max<size_t>(chunk_bytes, 1);
+            }
+        }
+        return offsets;
+    }
+
+    /** @brief Hint the kernel to read ahead for a sequential pass. */
+    void adviseSequential() const {
+        if (data_)
+            ::madvise(const_cast<uint8_t*>(data_), size_, MADV_SEQUENTIAL | MADV_WILLNEED);
+    }
+
+private:
+    void unmap() {
+        if (data_)
+            ::munmap(const_cast<uint8_t*>(data_), size_);
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+    std::string path_;
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+// ============================================================================
+// FrontendEvents
+// ============================================================================
+
+/**
+ * @brief Banks of one FrontendEvent within a MIDAS event.
+ *
+ * A FrontendEvent starts at its data bank (AD, or AR from the RAW
+ * collector mode) and runs to the next one. The per-cycle banks (AC, AB,
+ * AF, AZ) follow the last FrontendEvent of a cycle, so they appear in that
+ * event's range.
+ */
+class FrontendEventBanks : public MidasBankRange {
+public:
+    using MidasBankRange::MidasBankRange;
+
+    /** @brief The AD (or AR) bank that opens this FrontendEvent. */
+    MidasBankView dataBank() const { return *begin(); }
+};
+
+/**
+ * @brief Call @p fn(const FrontendEventBanks&) for each FrontendEvent packed
+ *        into @p ev (one per MIDAS event, or several with batched readout).
+ *
+ * Banks before the first data bank are skipped.
+ */
+template <typename Fn>
+void forEachFrontendEvent(const MidasEventView& ev, Fn&& fn,
+                          std::string_view data_prefix = "AD",
+                          std::string_view raw_prefix = "AR") {
+    const MidasBankRange banks = ev.banks();
+    MidasBankIterator start = banks.end();
+    for (MidasBankIterator it = banks.begin(); it != banks.end(); ++it) {
+        if (it->hasPrefix(data_prefix) || it->hasPrefix(raw_prefix)) {
+            if (start != banks.end())
+                fn(FrontendEventBanks(start, it));
+            start = it;
+        }
+    }
+    if (start != banks.end())
+        fn(FrontendEventBanks(start, banks.end()));
+}
+
+// ============================================================================
+// AD hits (HITSTRUCT layout)
+// ============================================================================
+
+/**
+ * @class AdHitView
+ * @brief One hit of a HITSTRUCT AD bank, as written by FrontendEventBankData:
+ *        the HitStruct header (up to RawDataSamples) followed by the section
+ *        from CorrectedDataSamples up to AdvancedParams.
+ *
+ * Fields are read by HitStruct offset, so the view follows the vendor
+ * header the reader is compiled against; it must match the frontend's.
+ */
+class AdHitView {
+public:
+    static constexpr size_t kHeaderBytes = offsetof(HitStruct, RawDataSamples);
+    static constexpr size_t kCorrectedOffset = offsetof(HitStruct, CorrectedDataSamples);
+    static constexpr size_t kCorrectedBytes = offsetof(HitStruct, AdvancedParams) - kCorrectedOffset;
+
+    /// Bytes per hit in the bank.
+    static constexpr size_t kBytes = kHeaderBytes + kCorrectedBytes;
+
+    /// Capacity of CorrectedDataSamples.
+    static constexpr size_t kMaxSamples = sizeof(HitStruct::CorrectedDataSamples) / sizeof(float);
+
+    explicit AdHitView(const uint8_t* p) : p_(p) {}
+
+    /**
+     * @brief Read the scalar HitStruct member at @p offset (from offsetof).
+     *
+     * Only members in the stored sections are valid: the header before
+     * RawDataSamples, and CorrectedDataSamples up to AdvancedParams.
+     * See SAMPIC_AD_FIELD for the usual spelling.
+     */
+    template <typename T>
+    T field(size_t offset) const {
+        const uint8_t* src = offset < kHeaderBytes
+            ? p_ + offset
+            : p_ + kHeaderBytes + (offset - kCorrectedOffset);
+        return detail::load<T>(src);
+    }
+
+    int board() const      { return field<int>(offsetof(HitStruct, FeBoardIndex)); }
+    int chip() const       { return field<int>(offsetof(HitStruct, SampicIndex)); }
+    int channel() const    { return field<int>(offsetof(HitStruct, Channel)); }
+    int hitNumber() const  { return field<int>(offsetof(HitStruct, HitNumber)); }
+    int dataSize() const   { return field<int>(offsetof(HitStruct, DataSize)); }
+    double firstCellTimeStamp() const { return field<double>(offsetof(HitStruct, FirstCellTimeStamp)); }
+    double timeInstant() const { return field<double>(offsetof(HitStruct, TimeInstant)); }
+    double baseline() const    { return field<double>(offsetof(HitStruct, Baseline)); }
+    double peak() const        { return field<double>(offsetof(HitStruct, Peak)); }
+    double amplitude() const   { return field<double>(offsetof(HitStruct, Amplitude)); }
+    double totValue() const    { return field<double>(offsetof(HitStruct, TOTValue)); }
+
+    /** @brief Valid corrected samples (DataSize, clamped to the array). */
+    size_t numSamples() const {
+        const int n = dataSize();
+        return n <= 0 ? 0 : std::min<size_t>(static_cast<size_t>(n), kMaxSamples);
+    }
+
+    /** @brief Corrected sample @p i (unchecked against numSamples()). */
+    float sample(size_t i) const { return detail::load<float>(samplesBytes() + i * sizeof(float)); }
+
+    /** @brief Copy the numSamples() corrected samples to @p out; returns the count. */
+    size_t copySamples(float* out) const {
+        const size_t n = numSamples();
+        std::memcpy(out, samplesBytes(), n * sizeof(float));
+        return n;
+    }
+
+    /** @brief The hit's kBytes bytes in the bank. */
+    std::span<const uint8_t> bytes() const { return {p_, kBytes}; }
+
+private:
+    const uint8_t* samplesBytes() const { return p_ + kHeaderBytes; }
+
+    const uint8_t* p_;
+};
+
+/// Read the scalar HitStruct member @p member from an AdHitView.
+#define SAMPIC_AD_FIELD(hit, member) \
+    ((hit).template field<decltype(HitStruct::member)>(offsetof(HitStruct, member)))
+
+/// The hits of a HITSTRUCT AD bank.
+class AdBankView {
+public:
+    class iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = AdHitView;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = AdHitView;
+
+        iterator() = default;
+        explicit iterator(const uint8_t* p) : p_(p) {}
+
+        AdHitView operator*() const { return AdHitView(p_); }
+        iterator& operator++() { p_ += AdHitView::kBytes; return *this; }
+        iterator operator++(int) { iterator old = *this; ++*this; return old; }
+        bool operator==(const iterator& o) const { return p_ == o.p_; }
+
+    private:
+        const uint8_t* p_ = nullptr;
+    };
+
+    explicit AdBankView(std::span<const uint8_t> data) : data_(data) {}
+
+    /** @brief Whether the payload is a whole number of hits (else not HITSTRUCT). */
+    bool valid() const { return data_.size() % AdHitView::kBytes == 0; }
+
+    size_t size() const { return data_.size() / AdHitView::kBytes; }
+    bool empty() const { return size() == 0; }
+
+    AdHitView operator[](size_t i) const { return AdHitView(data_.data() + i * AdHitView::kBytes); }
+
+    iterator begin() const { return iterator(data_.data()); }
+    iterator end() const { return iterator(data_.data() + size() * AdHitView::kBytes); }
+
+private:
+    std::span<const uint8_t> data_;
+};
+
+// ============================================================================
+// Parallel scan
+// ============================================================================
+
+/// Settings for parallelScan().
+struct MidasScanOptions {
+    /// Worker threads; 0 = one per hardware thread.
+    unsigned num_threads = 0;
+
+    /// Files larger than this are split at event boundaries into pieces of
+    /// about this size, so a few large files still keep every worker busy.
+    /// 0 = one piece per file.
+    size_t chunk_bytes = size_t{64} << 20;
+};
+
+/**
+ * @brief Call @p fn(const MidasFile&, const MidasEventView&, unsigned worker)
+ *        for every event of @p paths, on a pool of worker threads.
+ *
+ * Files are mapped and cut into pieces (see MidasScanOptions::chunk_bytes),
+ * which the workers take in turn. Events of one piece are visited in file
+ * order by one worker; pieces run concurrently and in no fixed order, so
+ * @p fn should accumulate into per-worker state indexed by @p worker
+ * (0 .. threads-1) and merge afterwards. Cutting a file reads its event
+ * headers once up front; with batched readout that is a small fraction of
+ * the file.
+ *
+ * The first exception thrown by @p fn (or by opening a file) stops the
+ * scan and is rethrown here.
+ *
+ * @return Number of worker threads used.
+ */
+template <typename Fn>
+unsigned parallelScan(const std::vector<std::string>& paths, Fn&& fn,
+                      const MidasScanOptions& opt = {}) {
+    std::vector<MidasFile> files;
+    files.reserve(paths.size());
+    for (const auto& p : paths)
+        files.emplace_back(p);
+
+    struct Piece {
+        const MidasFile* file;
+        uint64_t begin;
+        uint64_t end;
+    };
+    std::vector<Piece> pieces;
+    for (const MidasFile& f : files) {
+        if (opt.chunk_bytes == 0 || f.size() <= opt.chunk_bytes) {
+            pieces.push_back({&f, 0, f.size()});
+            continue;
+        }
+        const std::vector<uint64_t> offsets = f.chunkOffsets(opt.chunk_bytes);
+        for (size_t i = 0; i < offsets.size(); ++i)
+            pieces.push_back({&f, offsets[i], i + 1 < offsets.size() ? offsets[i + 1] : f.size()});
+    }
+
+    // Largest pieces first, so a big file does not end up last on one worker
+    std::stable_sort(pieces.begin(), pieces.end(), [](const Piece& a, const Piece& b) {
+        return (a.end - a.begin) > (b.end - b.begin);
+    });
+
+    unsigned threads = opt.num_threads ? opt.num_threads : std::max(1u, std::thread::hardware_concurrency());
+    threads = static_cast<unsigned>(std::min<size_t>(threads, std::max<size_t>(pieces.size(), 1)));
+
+    std::atomic<size_t> next{0};
+    std::atomic<bool> failed{false};
+    std::exception_ptr error;
+    std::mutex error_mtx;
+
+    auto work = [&](unsigned worker) {
+        try {
+            while (!failed.load(std::memory_order_relaxed)) {
+                const size_t i = next.fetch_add(1);
+                if (i >= pieces.size())
+                    break;
+                const Piece& piece = pieces[i];
+                for (const MidasEventView& ev : piece.file->events(piece.begin, piece.end))
+                    fn(*piece.file, ev, worker);
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(error_mtx);
+            if (!error)
+                error = std::current_exception();
+            failed = true;
+        }
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(threads - 1);
+    for (unsigned t = 1; t < threads; ++t)
+        pool.emplace_back(work, t);
+    work(0);
+    for (auto& th : pool)
+        th.join();
+
+    if (error)
+        std::rethrow_exception(error);
+    return threads;
+}
+
+} // namespace sampic
+
+#endif // SAMPIC_MIDAS_READER_H
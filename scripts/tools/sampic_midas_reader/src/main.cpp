@@ -0,0 +1,389 @@
+// ============================================================================
+// sampic_midas_reader_benchmark
+//
+// Measures sampic_midas_reader.h throughput (GB/s of MIDAS file) for a full
+// pass over every AD hit (header fields and corrected samples) and AT/AC
+// record, once on one thread and once with parallelScan(). Both passes fold
+// what they read into an order-independent checksum, which must agree.
+//
+// --synthesize writes a MIDAS file in the frontend's layout (BANK32, AD in
+// HITSTRUCT layout, AT per FrontendEvent, AC per cycle) so the benchmark
+// can run without a DAQ.
+// ============================================================================
+
+#include "sampic_midas_reader.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <exception>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct Options {
+    std::vector<std::string> inputs;
+    unsigned threads = 0;
+    size_t chunk_mb = 64;
+    int repeat = 3;
+
+    std::string synthesize;
+    size_t synth_mb = 1024;
+    int hits_per_frontend_event = 64;
+    int frontend_events_per_cycle = 16;
+    int samples = 64;
+};
+
+void showHelp(const char* argv0) {
+    std::printf(
+        "Usage: %s [OPTIONS] <file.mid>...\n"
+        "\n"
+        "Options:\n"
+        "  -t, --threads <n>          Worker threads for the parallel pass (default: all cores)\n"
+        "  -c, --chunk-mb <n>         Split files into pieces of this size (default: 64, 0 = whole files)\n"
+        "  -r, --repeat <n>           Passes per mode; the fastest is reported (default: 3)\n"
+        "\n"
+        "  -S, --synthesize <file>    Write a synthetic MIDAS file and exit\n"
+        "      --size-mb <n>          Size of the synthetic file (default: 1024)\n"
+        "      --hits <n>             Hits per FrontendEvent (default: 64)\n"
+        "      --events <n>           FrontendEvents per MIDAS event / cycle (default: 16)\n"
+        "      --samples <n>          Corrected samples per hit (default: 64)\n"
+        "  -h, --help                 Display this help message\n",
+        argv0);
+}
+
+bool parseArgs(int argc, char** argv, Options& opt) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string a = argv[i];
+        const bool has_value = i + 1 < argc;
+        if (a == "-h" || a == "--help") {
+            showHelp(argv[0]);
+            return false;
+        } else if ((a == "-t" || a == "--threads") && has_value) {
+            opt.threads = static_cast<unsigned>(std::atoi(argv[++i]));
+        } else if ((a == "-c" || a == "--chunk-mb") && has_value) {
+            opt.chunk_mb = static_cast<size_t>(std::atoll(argv[++i]));
+        } else if ((a == "-r" || a == "--repeat") && has_value) {
+            opt.repeat = std::max(1, std::atoi(argv[++i]));
+        } else if ((a == "-S" || a == "--synthesize") && has_value) {
+            opt.synthesize = argv[++i];
+        } else if (a == "--size-mb" && has_value) {
+            opt.synth_mb = static_cast<size_t>(std::atoll(argv[++i]));
+        } else if (a == "--hits" && has_value) {
+            opt.hits_per_frontend_event = std::max(1, std::atoi(argv[++i]));
+        } else if (a == "--events" && has_value) {
+            opt.frontend_events_per_cycle = std::max(1, std::atoi(argv[++i]));
+        } else if (a == "--samples" && has_value) {
+            opt.samples = std::max(0, std::atoi(argv[++i]));
+        } else if (!a.empty() && a[0] != '-') {
+            opt.inputs.push_back(a);
+        } else {
+            std::fprintf(stderr, "Unknown option: %s\n", a.c_str());
+            showHelp(argv[0]);
+            return false;
+        }
+    }
+    if (opt.synthesize.empty() && opt.inputs.empty()) {
+        showHelp(argv[0]);
+        return false;
+    }
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Synthetic file
+// ----------------------------------------------------------------------------
+
+class MidasWriter {
+public:
+    explicit MidasWriter(const std::string& path) : f_(std::fopen(path.c_str(), "wb")) {}
+    ~MidasWriter() { if (f_) std::fclose(f_); }
+
+    bool ok() const { return f_ != nullptr; }
+    size_t written() const { return written_; }
+
+    void beginEvent(uint16_t id) {
+        event_.clear();
+        id_ = id;
+        put<uint32_t>(0);   // BANK_HEADER data_size, set in endEvent()
+        put<uint32_t>(1u | sampic::MidasFormat::kBank32);  // BANK_FORMAT_VERSION | 32BIT
+    }
+
+    /// Append a BANK32 with @p size bytes and return its payload.
+    uint8_t* addBank(const char name[4], size_t size) {
+        event_.insert(event_.end(), name, name + 4);
+        put<uint32_t>(1);   // TID_UINT8
+        put<uint32_t>(static_cast<uint32_t>(size));
+        const size_t at = event_.size();
+        event_.resize(at + sampic::detail::align8(size), 0);
+        return event_.data() + at;
+    }
+
+    /// Special events carry raw data (an ODB dump) instead of banks.
+    void writeSpecial(uint16_t id, const std::string& text) {
+        event_.assign(text.begin(), text.end());
+        event_.push_back(0);
+        id_ = id;
+        flush(0x494d);  // "MI"
+    }
+
+    void endEvent() {
+        const uint32_t bank_bytes = static_cast<uint32_t>(event_.size() - sampic::MidasFormat::kBankHeaderBytes);
+        std::memcpy(event_.data(), &bank_bytes, 4);
+        flush(1);
+    }
+
+private:
+    template <typename T>
+    void put(T v) {
+        const auto* p = reinterpret_cast<const uint8_t*>(&v);
+        event_.insert(event_.end(), p, p + sizeof(T));
+    }
+
+    void flush(uint16_t mask) {
+        uint8_t header[sampic::MidasFormat::kEventHeaderBytes];
+        const uint32_t now = static_cast<uint32_t>(std::time(nullptr));
+        const uint32_t size = static_cast<uint32_t>(event_.size());
+        std::memcpy(header, &id_, 2);
+        std::memcpy(header + 2, &mask, 2);
+        std::memcpy(header + 4, &serial_, 4);
+        std::memcpy(header + 8, &now, 4);
+        std::memcpy(header + 12, &size, 4);
+        std::fwrite(header, 1, sizeof header, f_);
+        std::fwrite(event_.data(), 1, event_.size(), f_);
+        written_ += sizeof header + event_.size();
+        ++serial_;
+    }
+
+    std::FILE* f_;
+    std::vector<uint8_t> event_;
+    uint16_t id_ = 1;
+    uint32_t serial_ = 0;
+    size_t written_ = 0;
+};
+
+int synthesize(const Options& opt) {
+    using sampic::AdHitView;
+
+    MidasWriter out(opt.synthesize);
+    if (!out.ok()) {
+        std::fprintf(stderr, "Cannot create %s\n", opt.synthesize.c_str());
+        return 1;
+    }
+
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<float> noise(-0.01f, 0.01f);
+    const int samples = static_cast<int>(std::min<size_t>(opt.samples, AdHitView::kMaxSamples));
+
+    // A pool of hits to copy from, so writing is not dominated by the RNG
+    std::vector<std::vector<uint8_t>> pool(1024, std::vector<uint8_t>(AdHitView::kBytes));
+    auto hit = std::make_unique<HitStruct>();
+    for (size_t i = 0; i < pool.size(); ++i) {
+        std::memset(hit.get(), 0, sizeof(HitStruct));
+        hit->FeBoardIndex = static_cast<int>(i % 4);
+        hit->SampicIndex = static_cast<int>(i / 4 % 4);
+        hit->Channel = static_cast<int>(i % 64);
+        hit->HitNumber = static_cast<int>(i);
+        hit->DataSize = samples;
+        hit->FirstCellTimeStamp = 1000.0 * static_cast<double>(i);
+        hit->Baseline = 0.0;
+        hit->Amplitude = -0.3 - 0.001 * static_cast<double>(i % 100);
+        for (int s = 0; s < samples; ++s)
+            hit->CorrectedDataSamples[s] = noise(rng) + (s > 10 && s < 30 ? static_cast<float>(hit->Amplitude) : 0.0f);
+        const auto* src = reinterpret_cast<const uint8_t*>(hit.get());
+        std::memcpy(pool[i].data(), src, AdHitView::kHeaderBytes);
+        std::memcpy(pool[i].data() + AdHitView::kHeaderBytes, src + AdHitView::kCorrectedOffset,
+                    AdHitView::kCorrectedBytes);
+    }
+
+    out.writeSpecial(0x8000, "[/Runinfo]\nRun number = INT : 1\n");  // BOR
+
+    const size_t target = opt.synth_mb << 20;
+    uint64_t fe_ts = 0;
+    size_t next_hit = 0;
+    while (out.written() < target) {
+        out.beginEvent(1);
+        uint32_t cycle_hits = 0;
+        for (int e = 0; e < opt.frontend_events_per_cycle; ++e) {
+            const size_t n = static_cast<size_t>(opt.hits_per_frontend_event);
+            uint8_t* ad = out.addBank("AD00", n * AdHitView::kBytes);
+            for (size_t h = 0; h < n; ++h, next_hit = (next_hit + 1) % pool.size())
+                std::memcpy(ad + h * AdHitView::kBytes, pool[next_hit].data(), AdHitView::kBytes);
+
+            sampic::EventTimingRecord at{};
+            at.fe_timestamp_ns = fe_ts += 1000;
+            at.nhits = static_cast<uint32_t>(n);
+            at.nparents = 1;
+            std::memcpy(out.addBank("AT00", sizeof at), &at, sizeof at);
+            cycle_hits += static_cast<uint32_t>(n);
+        }
+        sampic::CollectorTimingRecord ac{};
+        ac.collector_timestamp_ns = fe_ts;
+        ac.n_events = static_cast<uint32_t>(opt.frontend_events_per_cycle);
+        ac.total_hits = cycle_hits;
+        std::memcpy(out.addBank("AC00", sizeof ac), &ac, sizeof ac);
+        out.endEvent();
+    }
+
+    out.writeSpecial(0x8001, "[/Runinfo]\nRun number = INT : 1\n");  // EOR
+
+    std::printf("Wrote %s: %.1f MB\n", opt.synthesize.c_str(), static_cast<double>(out.written()) / (1 << 20));
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Benchmark
+// ----------------------------------------------------------------------------
+
+/// What one pass reads, folded so that visiting order does not matter.
+struct Totals {
+    uint64_t midas_events = 0;
+    uint64_t frontend_events = 0;
+    uint64_t hits = 0;
+    uint64_t at_hits = 0;       ///< Sum of AT nhits (should equal hits)
+    uint64_t cycles = 0;        ///< AC banks
+    uint64_t checksum = 0;      ///< Sum of sample and field bit patterns
+
+    void operator+=(const Totals& o) {
+        midas_events += o.midas_events;
+        frontend_events += o.frontend_events;
+        hits += o.hits;
+        at_hits += o.at_hits;
+        cycles += o.cycles;
+        checksum += o.checksum;
+    }
+
+    bool operator==(const Totals&) const = default;
+};
+
+// Padded so workers do not share cache lines
+struct alignas(64) WorkerTotals {
+    Totals t;
+};
+
+uint64_t bits(double v) { uint64_t b; std::memcpy(&b, &v, 8); return b; }
+uint64_t bits(float v)  { uint32_t b; std::memcpy(&b, &v, 4); return b; }
+
+void visit(const sampic::MidasEventView& ev, Totals& t) {
+    if (ev.isSpecial())
+        return;
+    ++t.midas_events;
+    sampic::forEachFrontendEvent(ev, [&](const sampic::FrontendEventBanks& fe) {
+        ++t.frontend_events;
+        for (const sampic::MidasBankView& bank : fe) {
+            if (bank.hasPrefix("AD")) {
+                const sampic::AdBankView ad(bank.data);
+                for (sampic::AdHitView hit : ad) {
+                    ++t.hits;
+                    t.checksum += static_cast<uint64_t>(hit.board() * 64 + hit.channel());
+                    t.checksum += bits(hit.firstCellTimeStamp()) + bits(hit.amplitude());
+                    const size_t n = hit.numSamples();
+                    for (size_t s = 0; s < n; ++s)
+                        t.checksum += bits(hit.sample(s));
+                }
+            } else if (bank.hasPrefix("AT")) {
+                if (auto rec = bank.record<sampic::EventTimingRecord>())
+                    t.at_hits += rec->nhits;
+            } else if (bank.hasPrefix("AC")) {
+                if (bank.record<sampic::CollectorTimingRecord>())
+                    ++t.cycles;
+            }
+        }
+    });
+}
+
+Totals sequentialPass(const std::vector<std::string>& inputs) {
+    Totals t;
+    for (const auto& path : inputs) {
+        sampic::MidasFile f(path);
+        f.adviseSequential();
+        for (const sampic::MidasEventView& ev : f.events())
+            visit(ev, t);
+    }
+    return t;
+}
+
+Totals parallelPass(const std::vector<std::string>& inputs, const Options& opt, unsigned& threads_used) {
+    sampic::MidasScanOptions scan;
+    scan.num_threads = opt.threads;
+    scan.chunk_bytes = opt.chunk_mb << 20;
+
+    const unsigned max_threads = opt.threads ? opt.threads : std::max(1u, std::thread::hardware_concurrency());
+    std::vector<WorkerTotals> per_worker(max_threads);
+    threads_used = sampic::parallelScan(inputs, [&](const sampic::MidasFile&, const sampic::MidasEventView& ev, unsigned w) {
+        visit(ev, per_worker[w].t);
+    }, scan);
+
+    Totals t;
+    for (const auto& w : per_worker)
+        t += w.t;
+    return t;
+}
+
+template <typename Pass>
+double bestSeconds(int repeat, Pass&& pass) {
+    double best = 1e300;
+    for (int i = 0; i < repeat; ++i) {
+        const auto t0 = std::chrono::steady_clock::now();
+        pass();
+        const auto t1 = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double>(t1 - t0).count());
+    }
+    return best;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parseArgs(argc, argv, opt))
+        return 1;
+
+    if (!opt.synthesize.empty())
+        return synthesize(opt);
+
+    try {
+        uint64_t total_bytes = 0;
+        for (const auto& path : opt.inputs)
+            total_bytes += sampic::MidasFile(path).size();
+
+        Totals seq, par;
+        unsigned threads = 0;
+        const double seq_s = bestSeconds(opt.repeat, [&] { seq = sequentialPass(opt.inputs); });
+        const double par_s = bestSeconds(opt.repeat, [&] { par = parallelPass(opt.inputs, opt, threads); });
+
+        const double gb = static_cast<double>(total_bytes) / 1e9;
+        std::printf("%zu file(s), %.3f GB, %llu MIDAS events, %llu FrontendEvents, %llu hits, %llu cycles\n",
+                    opt.inputs.size(), gb,
+                    static_cast<unsigned long long>(seq.midas_events),
+                    static_cast<unsigned long long>(seq.frontend_events),
+                    static_cast<unsigned long long>(seq.hits),
+                    static_cast<unsigned long long>(seq.cycles));
+        if (seq.at_hits != seq.hits)
+            std::printf("note: AT banks count %llu hits, AD banks %llu (not all AD banks in HITSTRUCT layout?)\n",
+                        static_cast<unsigned long long>(seq.at_hits),
+                        static_cast<unsigned long long>(seq.hits));
+        std::printf("\n%-12s %8s %12s %10s %14s\n", "pass", "threads", "seconds", "GB/s", "hits/s");
+        std::printf("%-12s %8u %12.4f %10.2f %14.3e\n", "sequential", 1u, seq_s, gb / seq_s,
+                    static_cast<double>(seq.hits) / seq_s);
+        std::printf("%-12s %8u %12.4f %10.2f %14.3e\n", "parallel", threads, par_s, gb / par_s,
+                    static_cast<double>(par.hits) / par_s);
+
+        if (!(seq == par)) {
+            std::fprintf(stderr, "\nERROR: sequential and parallel passes disagree\n");
+            return 1;
+        }
+        std::printf("\nchecksum %016llx (passes agree)\n", static_cast<unsigned long long>(seq.checksum));
+    } catch (const std::exception& e) {
+        std::fprintf(stderr, "%s\n", e.what());
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,345 @@
+// ============================================================================
+// sampic_offline_decoder
+//
+// Decodes the "AR" raw frame banks written by the RAW SAMPIC collector mode.
+// Every AR bank is run through SAMPIC256CH_DecodeEvent and replaced, in
+// place, by an "AD" bank holding all hits of that readout, in the same
+// layout the online frontend writes (HITSTRUCT, COMPACT or PACKED). All other banks
+// and non-bank events (ODB dumps) are copied unchanged.
+//
+// Files are independent, so they are decoded in parallel: each worker
+// thread takes the next input file and owns its own crate structures.
+// ============================================================================
+
+#include "integration/sampic/collector/sampic_event.h"
+#include "integration/sampic/collector/sampic_hit_table.h"
+#include "integration/sampic/collector/sampic_raw_frames.h"
+#include "processing/sampic_processing/collector/banks/frontend_event_bank_data.h"
+#include "processing/sampic_processing/collector/banks/frontend_event_bank_compact_data.h"
+#include "processing/sampic_processing/collector/banks/frontend_event_bank_packed_data.h"
+
+#include <midas.h>
+#include <midasio.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+extern "C" {
+#include <SAMPIC_256Ch_lib.h>
+#include <SAMPIC_256Ch_Type.h>
+}
+
+namespace fs = std::filesystem;
+
+namespace {
+
+enum class Format { HITSTRUCT, COMPACT, PACKED };
+
+const char* formatName(Format f) {
+    switch (f) {
+        case Format::COMPACT: return "compact";
+        case Format::PACKED:  return "packed";
+        default:              return "hitstruct";
+    }
+}
+
+struct Options {
+    std::vector<std::string> inputs;
+    std::string output_dir;
+    std::string calib_dir = "resources/calib";
+    std::string raw_prefix = "AR";
+    std::string data_prefix = "AD";
+    Format format = Format::HITSTRUCT;
+    unsigned packed_bits = 11;
+    unsigned jobs = 0;
+};
+
+struct FileStats {
+    uint64_t events = 0;
+    uint64_t raw_banks = 0;
+    uint64_t bad_banks = 0;
+    uint64_t hits = 0;
+    uint64_t bytes_in = 0;
+    uint64_t bytes_out = 0;
+};
+
+void showHelp(const char* argv0) {
+    std::printf(
+        "Usage: %s [OPTIONS] <input.mid[.lz4|.gz]>...\n"
+        "\n"
+        "Options:\n"
+        "  -o, --output-dir <dir>   Directory for decoded files (required, must differ from the inputs')\n"
+        "  -c, --calib <dir>        Calibration directory for LoadAllCalibValuesFromFiles (default: resources/calib)\n"
+        "  -f, --format <fmt>       AD bank layout: hitstruct (default), compact or packed\n"
+        "      --packed-bits <n>    Minimum bits per ADC code for the packed layout (default: 11)\n"
+        "  -j, --jobs <n>           Files decoded in parallel (default: hardware threads)\n"
+        "      --raw-prefix <pp>    Prefix of the raw banks to decode (default: AR)\n"
+        "      --data-prefix <pp>   Prefix of the decoded banks (default: AD)\n"
+        "  -h, --help               Display this help message\n",
+        argv0);
+}
+
+bool parseArgs(int argc, char** argv, Options& opt) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string a = argv[i];
+        auto value = [&]() -> const char* {
+            if (i + 1 >= argc) {
+                spdlog::error("Missing value for {}", a);
+                return nullptr;
+            }
+            return argv[++i];
+        };
+
+        if (a == "-h" || a == "--help") {
+            showHelp(argv[0]);
+            std::exit(0);
+        } else if (a == "-o" || a == "--output-dir") {
+            const char* v = value(); if (!v) return false; opt.output_dir = v;
+        } else if (a == "-c" || a == "--calib") {
+            const char* v = value(); if (!v) return false; opt.calib_dir = v;
+        } else if (a == "-f" || a == "--format") {
+            const char* v = value(); if (!v) return false;
+            const std::string f = v;
+            if (f == "compact")        opt.format = Format::COMPACT;
+            else if (f == "packed")    opt.format = Format::PACKED;
+            else if (f == "hitstruct") opt.format = Format::HITSTRUCT;
+            else { spdlog::error("Unknown format '{}'", f); return false; }
+        } else if (a == "--packed-bits") {
+            const char* v = value(); if (!v) return false; opt.packed_bits = static_cast<unsigned>(std::stoul(v));
+        } else if (a == "-j" || a == "--jobs") {
+            const char* v = value(); if (!v) return false; opt.jobs = static_cast<unsigned>(std::stoul(v));
+        } else if (a == "--raw-prefix") {
+            const char* v = value(); if (!v) return false; opt.raw_prefix = v;
+        } else if (a == "--data-prefix") {
+            const char* v = value(); if (!v) return false; opt.data_prefix = v;
+        } else if (!a.empty() && a[0] == '-') {
+            spdlog::error("Unknown option: {}", a);
+            return false;
+        } else {
+            opt.inputs.push_back(a);
+        }
+    }
+
+    if (opt.inputs.empty() || opt.output_dir.empty()) {
+        showHelp(argv[0]);
+        return false;
+    }
+    if (opt.raw_prefix.size() != 2 || opt.data_prefix.size() != 2) {
+        spdlog::error("Bank prefixes must be exactly 2 characters");
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Decoder state owned by one worker thread.
+ *
+ * The vendor decode reads and writes through CrateInfoStruct /
+ * CrateParamStruct, so workers never share them.
+ */
+class Decoder {
+public:
+    explicit Decoder(const Options& opt) : opt_(opt) {
+        info_   = std::make_unique<CrateInfoStruct>();
+        params_ = std::make_unique<CrateParamStruct>();
+        SAMPIC256CH_SetDefaultParameters(info_.get(), params_.get());
+        SAMPIC256CH_LoadAllCalibValuesFromFiles(info_.get(), params_.get(),
+                                                const_cast<char*>(opt_.calib_dir.c_str()));
+    }
+
+    /// Decode one AR record into an AD bank payload; false if the record is unusable.
+    bool decode(const uint8_t* data, size_t size, std::vector<uint8_t>& out, uint64_t& nhits) {
+        SampicRawFrameHeader hdr{};
+        if (SampicRawFrames::unpack(data, size, hdr, frames_) == 0)
+            return false;
+
+        auto ev_data = std::make_shared<EventStruct>();
+        int numberOfHits = 0;
+        const auto err = SAMPIC256CH_DecodeEvent(info_.get(), params_.get(), frames_.data(),
+                                                 ev_data.get(), static_cast<int>(hdr.nframes),
+                                                 &numberOfHits);
+        if (err != SAMPIC256CH_Success) {
+            spdlog::debug("DecodeEvent failed for readout {} (errCode={})",
+                          hdr.sequence, static_cast<int>(err));
+            return false;
+        }
+
+        auto hits = std::make_shared<const SampicHitTable>(*ev_data);
+        nhits = hits->size();
+        auto ev = std::make_shared<SampicEvent>(ev_data, hits, SampicTimingBreakdown{},
+                                                std::chrono::steady_clock::time_point{});
+        const std::vector<std::shared_ptr<SampicEvent>> parents{ev};
+
+        out.clear();
+        if (opt_.format == Format::COMPACT) {
+            std::vector<FrontendEventBankCompactData::HitRef> refs(hits->size());
+            for (size_t i = 0; i < refs.size(); ++i)
+                refs[i] = {0u, static_cast<uint32_t>(i)};
+            FrontendEventBankCompactData bank(parents, refs);
+            out.assign(bank.data(), bank.data() + bank.size());
+        } else if (opt_.format == Format::PACKED) {
+            std::vector<const HitStruct*> ptrs(hits->size());
+            for (size_t i = 0; i < ptrs.size(); ++i)
+                ptrs[i] = &ev_data->Hit[i];
+            FrontendEventBankPackedData bank(ptrs, opt_.packed_bits);
+            out.assign(bank.data(), bank.data() + bank.size());
+        } else {
+            std::vector<const HitStruct*> ptrs(hits->size());
+            for (size_t i = 0; i < ptrs.size(); ++i)
+                ptrs[i] = &ev_data->Hit[i];
+            FrontendEventBankData bank(parents, ptrs);
+            out.resize(bank.size());
+            bank.serializeInto(out.data(), out.size());
+        }
+        return true;
+    }
+
+private:
+    const Options& opt_;
+    std::unique_ptr<CrateInfoStruct> info_;
+    std::unique_ptr<CrateParamStruct> params_;
+    std::vector<ML_Frame> frames_;
+};
+
+bool processFile(const Options& opt, Decoder& decoder, const fs::path& in, FileStats& st) {
+    const fs::path out = fs::path(opt.output_dir) / in.filename();
+
+    TMReaderInterface* reader = TMNewReader(in.c_str());
+    if (!reader || reader->fError) {
+        spdlog::error("{}: cannot open for reading", in.string());
+        delete reader;
+        return false;
+    }
+    TMWriterInterface* writer = TMNewWriter(out.c_str());
+    if (!writer) {
+        spdlog::error("{}: cannot open for writing", out.string());
+        reader->Close();
+        delete reader;
+        return false;
+    }
+
+    std::vector<uint8_t> payload;
+
+    while (TMEvent* ev = TMReadEvent(reader)) {
+        ++st.events;
+        st.bytes_in += ev->data.size();
+
+        // System events (begin/end of run ODB dumps) carry no banks
+        if (ev->event_id & 0x8000) {
+            TMWriteEvent(writer, ev);
+            st.bytes_out += ev->data.size();
+            delete ev;
+            continue;
+        }
+
+        ev->FindAllBanks();
+        TMEvent outev;
+        outev.Init(ev->event_id, ev->trigger_mask, ev->serial_number, ev->time_stamp);
+
+        for (const TMBank& b : ev->banks) {
+            const char* bdata = ev->GetBankData(&b);
+
+            if (b.name.compare(0, 2, opt.raw_prefix) == 0) {
+                ++st.raw_banks;
+                uint64_t nhits = 0;
+                if (decoder.decode(reinterpret_cast<const uint8_t*>(bdata), b.data_size, payload, nhits)) {
+                    st.hits += nhits;
+                    const std::string name = opt.data_prefix + b.name.substr(2);
+                    outev.AddBank(name.c_str(), TID_UINT8,
+                                  reinterpret_cast<const char*>(payload.data()), payload.size());
+                    continue;
+                }
+                ++st.bad_banks;  // keep the undecodable record as-is
+            }
+            outev.AddBank(b.name.c_str(), b.type, bdata, b.data_size);
+        }
+
+        TMWriteEvent(writer, &outev);
+        st.bytes_out += outev.data.size();
+        delete ev;
+    }
+
+    reader->Close();
+    delete reader;
+    writer->Close();
+    delete writer;
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parseArgs(argc, argv, opt))
+        return 1;
+
+    std::error_code ec;
+    fs::create_directories(opt.output_dir, ec);
+    for (const auto& in : opt.inputs) {
+        if (fs::equivalent(fs::path(in).parent_path().empty() ? "." : fs::path(in).parent_path(),
+                           opt.output_dir, ec)) {
+            spdlog::error("Output directory must differ from the input directory ({})", in);
+            return 1;
+        }
+    }
+
+    const unsigned hw = std::max(1u, std::thread::hardware_concurrency());
+    const unsigned jobs = std::min<unsigned>(opt.jobs > 0 ? opt.jobs : hw,
+                                             static_cast<unsigned>(opt.inputs.size()));
+
+    spdlog::info("Decoding {} file(s) with {} worker(s), format={}, {}xx -> {}xx",
+                 opt.inputs.size(), jobs, formatName(opt.format),
+                 opt.raw_prefix, opt.data_prefix);
+
+    std::vector<FileStats> stats(opt.inputs.size());
+    std::atomic<size_t> next{0};
+    std::atomic<int> failures{0};
+
+    const auto t0 = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (unsigned w = 0; w < jobs; ++w) {
+        workers.emplace_back([&] {
+            Decoder decoder(opt);
+            for (size_t i = next++; i < opt.inputs.size(); i = next++) {
+                const auto tf = std::chrono::steady_clock::now();
+                if (!processFile(opt, decoder, opt.inputs[i], stats[i])) {
+                    ++failures;
+                    continue;
+                }
+                const double s = std::chrono::duration<double>(std::chrono::steady_clock::now() - tf).count();
+                spdlog::info("{}: {} events, {} AR banks ({} undecodable), {} hits, {:.1f} MB in, {:.1f} s",
+                             opt.inputs[i], stats[i].events, stats[i].raw_banks, stats[i].bad_banks,
+                             stats[i].hits, stats[i].bytes_in / 1e6, s);
+            }
+        });
+    }
+    for (auto& t : workers)
+        t.join();
+    const double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    FileStats total{};
+    for (const auto& s : stats) {
+        total.events += s.events;
+        total.raw_banks += s.raw_banks;
+        total.bad_banks += s.bad_banks;
+        total.hits += s.hits;
+        total.bytes_in += s.bytes_in;
+        total.bytes_out += s.bytes_out;
+    }
+    spdlog::info("Done: {} events, {} AR banks, {} hits in {:.2f} s ({:.1f} MB/s in, {:.0f} hits/s)",
+                 total.events, total.raw_banks, total.hits, secs,
+                 secs > 0 ? total.bytes_in / 1e6 / secs : 0.0,
+                 secs > 0 ? total.hits / secs : 0.0);
+
+    return failures > 0 ? 1 : 0;
+}
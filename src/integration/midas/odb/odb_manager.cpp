@@ -48,6 +48,8 @@ json OdbManager::readRecursive(HNDLE key, const std::string& fullPath) {
 
     if (hasSubkeys)
         return result;
+    if (type == TID_KEY)
+        return json::object();  // empty directory, e.g. a map with no entries
 
     // Scalar leaf keys
     switch (type) {
@@ -119,8 +121,9 @@ void OdbManager::populateOdbHelper(const std::string& basePath, const json& j, O
     bool exists = (db_find_key(hDB_handle, 0, basePath.c_str(), &key) == DB_SUCCESS);
 
     if (j.is_object()) {
-        // Ensure directory key exists
-        if (!exists && mode == OdbMode::INITIALIZE) {
+        // Ensure directory key exists; also in WRITE mode, so that an empty
+        // object still leaves its key for the next read
+        if (!exists) {
             db_create_key(hDB_handle, 0, basePath.c_str(), TID_KEY);
         }
         // Recurse on object fields
@@ -0,0 +1,181 @@
+#include "integration/sampic/collector/buffers/sampic_event_buffer_default.h"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+
+SampicEventBufferDefault::SampicEventBufferDefault(size_t capacity,
+                                                   const BufferOverflowConfig& overflow)
+    : SampicEventBuffer(capacity, overflow),
+      last_timestamp_(std::chrono::steady_clock::time_point::min()) {}
+
+uint64_t SampicEventBufferDefault::unreadCount() const {
+    if (buffer_.empty())
+        return 0;
+    return last_seq_ - std::max(read_seq_, buffer_.front().seq - 1);
+}
+
+void SampicEventBufferDefault::releaseRead() {
+    while (!buffer_.empty() && buffer_.front().seq <= read_seq_)
+        buffer_.pop_front();
+}
+
+bool SampicEventBufferDefault::makeRoom(std::unique_lock<std::mutex>& lock) {
+    const auto deadline = std::chrono::steady_clock::now() +
+                          std::chrono::milliseconds(overflow_.block_timeout_ms);
+
+    while (!buffer_.empty() && buffer_.size() >= capacity_) {
+        // Entries already handed to a consumer can go without loss
+        if (buffer_.front().seq <= read_seq_) {
+            buffer_.pop_front();
+            continue;
+        }
+
+        switch (overflow_.policy) {
+            case BufferOverflowPolicy::DROP_OLDEST: {
+                const uint64_t n = counters_.recordDrop(buffer_.front().ev->numHits());
+                if (shouldLogDrop(n))
+                    spdlog::warn("SampicEventBuffer: full, evicted {} unread event(s) so far", n);
+                buffer_.pop_front();
+                break;
+            }
+            case BufferOverflowPolicy::BLOCK:
+                if (space_cv_.wait_until(lock, deadline, [&] {
+                        return buffer_.size() < capacity_ || buffer_.front().seq <= read_seq_;
+                    }))
+                    break;
+                [[fallthrough]];
+            case BufferOverflowPolicy::DROP_NEWEST:
+            default:
+                return false;
+        }
+    }
+    return true;
+}
+
+void SampicEventBufferDefault::push(const std::shared_ptr<SampicEvent>& ev) {
+    if (!ev) return;
+
+    std::unique_lock<std::mutex> lock(mtx_);
+
+    if (!makeRoom(lock)) {
+        const uint64_t n = counters_.recordDrop(ev->numHits());
+        if (shouldLogDrop(n))
+            spdlog::warn("SampicEventBuffer: full, rejected {} new event(s) so far", n);
+        return;
+    }
+
+    const auto ts = ev->timestamp();
+    buffer_.push_back(Entry{ev, ts, ++last_seq_});
+    last_timestamp_ = ts;
+    counters_.recordPush(unreadCount());
+    cv_.notify_all();
+}
+
+std::optional<std::shared_ptr<SampicEvent>> SampicEventBufferDefault::pop() {
+    std::unique_lock<std::mutex> lock(mtx_);
+    if (buffer_.empty())
+        return std::nullopt;
+
+    auto ev = buffer_.front().ev;
+    buffer_.pop_front();
+    space_cv_.notify_one();
+
+    // Warn if we are discarding an event that was never consumed
+    if (ev && !ev->consumed()) {
+        spdlog::warn("SampicEventBuffer: popping unconsumed event (timestamp={}us, hits={})",
+                     std::chrono::duration_cast<std::chrono::microseconds>(
+                         ev->timestamp().time_since_epoch()).count(),
+                     ev->numHits());
+    }
+
+    return ev;
+}
+
+std::optional<std::shared_ptr<SampicEvent>> SampicEventBufferDefault::latest() {
+    std::unique_lock<std::mutex> lock(mtx_);
+    if (buffer_.empty())
+        return std::nullopt;
+    return buffer_.back().ev;
+}
+
+std::vector<std::shared_ptr<SampicEvent>>
+SampicEventBufferDefault::getSince(std::chrono::steady_clock::time_point t) {
+    std::unique_lock<std::mutex> lock(mtx_);
+    std::vector<std::shared_ptr<SampicEvent>> result;
+    result.reserve(buffer_.size());
+
+    for (auto& entry : buffer_) {
+        if (entry.ts > t) {
+            result.push_back(entry.ev);
+            read_seq_ = std::max(read_seq_, entry.seq);
+        }
+    }
+    if (!result.empty()) {
+        releaseRead();
+        space_cv_.notify_one();
+    }
+    return result;
+}
+
+std::vector<std::shared_ptr<SampicEvent>>
+SampicEventBufferDefault::getSince(uint64_t& cursor) {
+    std::unique_lock<std::mutex> lock(mtx_);
+    std::vector<std::shared_ptr<SampicEvent>> result;
+    if (buffer_.empty() || cursor >= last_seq_)
+        return result;
+
+    // Sequence numbers in the deque are contiguous, so the first unread
+    // entry is found by offset. Events evicted before being read are skipped.
+    const uint64_t front_seq = buffer_.front().seq;
+    const size_t start = (cursor >= front_seq) ? static_cast<size_t>(cursor - front_seq + 1) : 0;
+
+    result.reserve(buffer_.size() - start);
+    for (size_t i = start; i < buffer_.size(); ++i)
+        result.push_back(buffer_[i].ev);
+
+    cursor = last_seq_;
+    read_seq_ = std::max(read_seq_, last_seq_);
+    releaseRead();
+    space_cv_.notify_one();
+    return result;
+}
+
+bool SampicEventBufferDefault::hasNewSince(std::chrono::steady_clock::time_point t) const {
+    std::unique_lock<std::mutex> lock(mtx_);
+    return last_timestamp_ > t;
+}
+
+bool SampicEventBufferDefault::hasNewSince(uint64_t cursor) const {
+    std::unique_lock<std::mutex> lock(mtx_);
+    return last_seq_ > cursor;
+}
+
+bool SampicEventBufferDefault::waitForNew(std::chrono::steady_clock::time_point t,
+                                          std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(mtx_);
+    return cv_.wait_for(lock, timeout, [&] { return last_timestamp_ > t; });
+}
+
+bool SampicEventBufferDefault::waitForNew(uint64_t cursor, std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(mtx_);
+    return cv_.wait_for(lock, timeout, [&] { return last_seq_ > cursor; });
+}
+
+uint64_t SampicEventBufferDefault::lastSequence() const {
+    std::unique_lock<std::mutex> lock(mtx_);
+    return last_seq_;
+}
+
+size_t SampicEventBufferDefault::size() const {
+    std::unique_lock<std::mutex> lock(mtx_);
+    return buffer_.size();
+}
+
+bool SampicEventBufferDefault::empty() const {
+    std::unique_lock<std::mutex> lock(mtx_);
+    return buffer_.empty();
+}
+
+BufferStats SampicEventBufferDefault::stats() const {
+    std::unique_lock<std::mutex> lock(mtx_);
+    return counters_.snapshot(unreadCount(), capacity_);
+}
@@ -0,0 +1,218 @@
+#include "integration/sampic/collector/buffers/sampic_event_buffer_spsc_ring.h"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <bit>
+#include <thread>
+
+SampicEventBufferSpscRing::SampicEventBufferSpscRing(size_t capacity,
+                                                     const BufferOverflowConfig& overflow)
+    : SampicEventBuffer(std::bit_ceil(std::max<size_t>(capacity, 2)), overflow),
+      last_ts_ns_(toNs(std::chrono::steady_clock::time_point::min()))
+{
+    slots_.resize(capacity_);
+    mask_ = capacity_ - 1;
+
+    if (capacity_ != capacity)
+        spdlog::debug("SampicEventBufferSpscRing: capacity {} rounded up to {}", capacity, capacity_);
+
+    if (overflow_.policy == BufferOverflowPolicy::DROP_OLDEST)
+        spdlog::info("SampicEventBufferSpscRing: DROP_OLDEST is not supported, dropping newest instead");
+}
+
+int64_t SampicEventBufferSpscRing::toNs(std::chrono::steady_clock::time_point t) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(t.time_since_epoch()).count();
+}
+
+// ------------------------------------------------------------------
+// Producer interface
+// ------------------------------------------------------------------
+
+bool SampicEventBufferSpscRing::hasSpace(uint64_t head) {
+    if (head - cached_tail_ < capacity_)
+        return true;
+    cached_tail_ = tail_.load(std::memory_order_acquire);
+    return head - cached_tail_ < capacity_;
+}
+
+bool SampicEventBufferSpscRing::waitForSpace(uint64_t head) {
+    // The consumer never signals the producer; spin briefly, then yield,
+    // then sleep in short steps so a stalled consumer costs little CPU.
+    const auto deadline = std::chrono::steady_clock::now() +
+                          std::chrono::milliseconds(overflow_.block_timeout_ms);
+    for (int spins = 0;; ++spins) {
+        if (hasSpace(head))
+            return true;
+        if (spins < 64)
+            continue;
+        if (std::chrono::steady_clock::now() >= deadline)
+            return false;
+        if (spins < 256)
+            std::this_thread::yield();
+        else
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+}
+
+void SampicEventBufferSpscRing::push(const std::shared_ptr<SampicEvent>& ev) {
+    if (!ev) return;
+
+    const uint64_t head = head_.load(std::memory_order_relaxed);
+    if (!hasSpace(head)) {
+        const bool freed = overflow_.policy == BufferOverflowPolicy::BLOCK && waitForSpace(head);
+        if (!freed) {
+            const uint64_t n = counters_.recordDrop(ev->numHits());
+            if (shouldLogDrop(n))
+                spdlog::warn("SampicEventBufferSpscRing: ring full, dropped {} event(s) so far", n);
+            return;
+        }
+    }
+
+    Slot& slot = slots_[head & mask_];
+    slot.ev = ev;
+    slot.ts_ns = toNs(ev->timestamp());
+
+    last_ts_ns_.store(slot.ts_ns, std::memory_order_relaxed);
+    // seq_cst store/load pair with the consumer's consumer_waiting_ handshake
+    head_.store(head + 1, std::memory_order_seq_cst);
+    // cached_tail_ may lag the consumer, so this is an upper bound on occupancy
+    counters_.recordPush(head + 1 - cached_tail_);
+
+    if (consumer_waiting_.load(std::memory_order_seq_cst)) {
+        std::lock_guard<std::mutex> lock(wait_mtx_);
+        wait_cv_.notify_one();
+    }
+}
+
+// ------------------------------------------------------------------
+// Consumer interface
+// ------------------------------------------------------------------
+
+std::optional<std::shared_ptr<SampicEvent>> SampicEventBufferSpscRing::pop() {
+    const uint64_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail == cached_head_) {
+        cached_head_ = head_.load(std::memory_order_acquire);
+        if (tail == cached_head_)
+            return std::nullopt;
+    }
+
+    Slot& slot = slots_[tail & mask_];
+    auto ev = std::move(slot.ev);
+    tail_.store(tail + 1, std::memory_order_release);
+
+    if (ev && !ev->consumed()) {
+        spdlog::warn("SampicEventBuffer: popping unconsumed event (timestamp={}us, hits={})",
+                     std::chrono::duration_cast<std::chrono::microseconds>(
+                         ev->timestamp().time_since_epoch()).count(),
+                     ev->numHits());
+    }
+
+    return ev;
+}
+
+std::optional<std::shared_ptr<SampicEvent>> SampicEventBufferSpscRing::latest() {
+    const uint64_t tail = tail_.load(std::memory_order_relaxed);
+    cached_head_ = head_.load(std::memory_order_acquire);
+    if (tail == cached_head_)
+        return std::nullopt;
+    return slots_[(cached_head_ - 1) & mask_].ev;
+}
+
+std::vector<std::shared_ptr<SampicEvent>>
+SampicEventBufferSpscRing::getSince(uint64_t& cursor) {
+    std::vector<std::shared_ptr<SampicEvent>> result;
+
+    uint64_t tail = tail_.load(std::memory_order_relaxed);
+    cached_head_ = head_.load(std::memory_order_acquire);
+    if (tail == cached_head_)
+        return result;
+
+    // Slots at or before the cursor were already handed out by an earlier call
+    result.reserve(static_cast<size_t>(cached_head_ - tail));
+    for (; tail != cached_head_; ++tail) {
+        Slot& slot = slots_[tail & mask_];
+        if (tail + 1 > cursor)
+            result.push_back(std::move(slot.ev));
+        else
+            slot.ev.reset();
+    }
+    tail_.store(tail, std::memory_order_release);
+    cursor = std::max(cursor, cached_head_);
+    return result;
+}
+
+std::vector<std::shared_ptr<SampicEvent>>
+SampicEventBufferSpscRing::getSince(std::chrono::steady_clock::time_point t) {
+    std::vector<std::shared_ptr<SampicEvent>> result;
+
+    uint64_t tail = tail_.load(std::memory_order_relaxed);
+    cached_head_ = head_.load(std::memory_order_acquire);
+    if (tail == cached_head_)
+        return result;
+
+    const int64_t t_ns = toNs(t);
+    result.reserve(static_cast<size_t>(cached_head_ - tail));
+
+    for (; tail != cached_head_; ++tail) {
+        Slot& slot = slots_[tail & mask_];
+        if (slot.ts_ns > t_ns)
+            result.push_back(std::move(slot.ev));
+        else
+            slot.ev.reset();
+    }
+    tail_.store(tail, std::memory_order_release);
+    return result;
+}
+
+// ------------------------------------------------------------------
+// Polling helpers
+// ------------------------------------------------------------------
+
+bool SampicEventBufferSpscRing::hasNewSince(std::chrono::steady_clock::time_point t) const {
+    // The seq_cst head load orders this check against the producer's publish;
+    // last_ts_ns_ is written before head_, so it is visible once head_ is.
+    head_.load(std::memory_order_seq_cst);
+    return last_ts_ns_.load(std::memory_order_relaxed) > toNs(t);
+}
+
+bool SampicEventBufferSpscRing::hasNewSince(uint64_t cursor) const {
+    return head_.load(std::memory_order_seq_cst) > cursor;
+}
+
+template <typename Pred>
+bool SampicEventBufferSpscRing::waitUntil(Pred ready, std::chrono::milliseconds timeout) {
+    if (ready())
+        return true;
+
+    std::unique_lock<std::mutex> lock(wait_mtx_);
+    consumer_waiting_.store(true, std::memory_order_seq_cst);
+    const bool ok = wait_cv_.wait_for(lock, timeout, ready);
+    consumer_waiting_.store(false, std::memory_order_relaxed);
+    return ok;
+}
+
+bool SampicEventBufferSpscRing::waitForNew(std::chrono::steady_clock::time_point t,
+                                           std::chrono::milliseconds timeout) {
+    return waitUntil([&] { return hasNewSince(t); }, timeout);
+}
+
+bool SampicEventBufferSpscRing::waitForNew(uint64_t cursor, std::chrono::milliseconds timeout) {
+    return waitUntil([&] { return hasNewSince(cursor); }, timeout);
+}
+
+uint64_t SampicEventBufferSpscRing::lastSequence() const {
+    return head_.load(std::memory_order_acquire);
+}
+
+size_t SampicEventBufferSpscRing::size() const {
+    const uint64_t tail = tail_.load(std::memory_order_acquire);
+    const uint64_t head = head_.load(std::memory_order_acquire);
+    return static_cast<size_t>(head - tail);
+}
+
+bool SampicEventBufferSpscRing::empty() const {
+    return size() == 0;
+}
+
+BufferStats SampicEventBufferSpscRing::stats() const {
+    return counters_.snapshot(size(), capacity_);
+}
@@ -27,7 +27,7 @@ SampicCollectorModeDefault::SampicCollectorModeDefault(
 bool SampicCollectorModeDefault::collect()
 {
     SampicTimingBreakdown timing{};
-    auto ev_data = std::make_shared<EventStruct>();
+    auto ev_data = acquireEventStruct();
 
     const auto t_start = std::chrono::steady_clock::now();
     SAMPIC256CH_PrepareEvent(&info_, &params_);
@@ -52,6 +52,8 @@ bool SampicCollectorModeDefault::collect()
 
         if (errCode == SAMPIC256CH_Success)
         {
+            recordRaw(mlFrames_, nframes, t_read_start, t_read_end);
+
             const auto t_decode_start = std::chrono::steady_clock::now();
             errCode = SAMPIC256CH_DecodeEvent(&info_, &params_, mlFrames_, ev_data.get(), nframes, &numberOfHits);
             const auto t_decode_end = std::chrono::steady_clock::now();
@@ -90,9 +92,7 @@ bool SampicCollectorModeDefault::collect()
 
     if (errCode == SAMPIC256CH_Success && numberOfHits > 0)
     {
-        auto ev = std::make_shared<SampicEvent>(
-            ev_data, timing, std::chrono::steady_clock::now());
-        buffer_.push(ev);
+        pushEvent(std::move(ev_data), timing);
 
         spdlog::debug("SAMPIC default mode: collected {} hits "
                       "(prepare={}us, read={}us, decode={}us, total={}us)",
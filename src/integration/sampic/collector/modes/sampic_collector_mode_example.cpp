@@ -20,7 +20,7 @@ SampicCollectorModeExample::SampicCollectorModeExample(
 bool SampicCollectorModeExample::collect()
 {
     SampicTimingBreakdown timing{};
-    auto ev_data = std::make_shared<EventStruct>();
+    auto ev_data = acquireEventStruct();
 
     const auto t_start = std::chrono::steady_clock::now();
     SAMPIC256CH_PrepareEvent(&info_, &params_);
@@ -44,6 +44,8 @@ bool SampicCollectorModeExample::collect()
 
         if (errCode == SAMPIC256CH_Success)
         {
+            recordRaw(mlFrames_, nframes, t_read_start, t_read_end);
+
             const auto t_decode_start = std::chrono::steady_clock::now();
             errCode = SAMPIC256CH_DecodeEvent(&info_, &params_, mlFrames_, ev_data.get(), nframes, &numberOfHits);
             const auto t_decode_end = std::chrono::steady_clock::now();
@@ -81,9 +83,7 @@ bool SampicCollectorModeExample::collect()
 
     if (errCode == SAMPIC256CH_Success && numberOfHits > 0)
     {
-        auto ev = std::make_shared<SampicEvent>(
-            ev_data, timing, std::chrono::steady_clock::now());
-        buffer_.push(ev);
+        pushEvent(std::move(ev_data), timing);
 
         spdlog::debug("Example mode: collected {} hits "
                       "(prepare={}us, read={}us, decode={}us, total={}us)",
@@ -0,0 +1,288 @@
+#include "integration/sampic/collector/modes/sampic_collector_mode_pipelined.h"
+#include "integration/sampic/collector/sampic_event.h"
+
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+
+std::chrono::microseconds usSince(std::chrono::steady_clock::time_point t0) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - t0);
+}
+
+} // namespace
+
+SampicCollectorModePipelined::SampicCollectorModePipelined(
+    SampicEventBuffer& buffer,
+    CrateInfoStruct& info,
+    CrateParamStruct& params,
+    void* eventBuffer,
+    ML_Frame* mlFrames,
+    const SampicCollectorConfig& cfg)
+    : SampicCollectorMode(buffer, info, params, eventBuffer, mlFrames, cfg),
+      mode_cfg_(cfg.pipelined_mode)
+{
+    const int n_decoders = std::max(1, mode_cfg_.num_decoders);
+    const int n_slots    = std::max(mode_cfg_.ring_slots, n_decoders + 1);
+
+    // ---------------------------------------------------------------------
+    // Frame ring: one vendor-allocated event buffer / ML_Frame set per slot
+    // ---------------------------------------------------------------------
+    slots_.resize(n_slots);
+    for (auto& s : slots_) {
+        const SAMPIC256CH_ErrCode err = SAMPIC256CH_AllocateEventMemory(&s.event_buffer, &s.frames);
+        if (err != SAMPIC256CH_Success) {
+            for (auto& a : slots_) {
+                if (a.event_buffer || a.frames)
+                    SAMPIC256CH_FreeEventMemory(&a.event_buffer, &a.frames);
+            }
+            throw std::runtime_error("SampicCollectorModePipelined: AllocateEventMemory failed (errCode=" +
+                                     std::to_string(static_cast<int>(err)) + ")");
+        }
+    }
+
+    // ---------------------------------------------------------------------
+    // Decoder pool
+    // ---------------------------------------------------------------------
+    decoder_stats_.resize(n_decoders);
+    decoders_.reserve(n_decoders);
+    for (int i = 0; i < n_decoders; ++i)
+        decoders_.emplace_back(&SampicCollectorModePipelined::decodeLoop, this, i);
+
+    spdlog::info("SampicCollectorModePipelined initialized: num_decoders={}, ring_slots={}, "
+                 "soft_trigger_prepare_interval={}, soft_trigger_max_loops={}, soft_trigger_retry_sleep_us={}",
+                 n_decoders, n_slots,
+                 mode_cfg_.soft_trigger_prepare_interval,
+                 mode_cfg_.soft_trigger_max_loops,
+                 mode_cfg_.soft_trigger_retry_sleep_us);
+}
+
+SampicCollectorModePipelined::~SampicCollectorModePipelined()
+{
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+        stopping_ = true;
+    }
+    work_cv_.notify_all();
+    free_cv_.notify_all();
+    for (auto& t : decoders_) {
+        if (t.joinable())
+            t.join();
+    }
+
+    spdlog::info("SampicCollectorModePipelined reader: events={}, read={}us (max {}us), stalled on full ring={}us",
+                 reader_stats_.events, reader_stats_.busy.count(), reader_stats_.max.count(),
+                 reader_stall_.count());
+    for (size_t i = 0; i < decoder_stats_.size(); ++i) {
+        const auto& d = decoder_stats_[i];
+        spdlog::info("SampicCollectorModePipelined decoder {}: events={}, decode={}us (max {}us)",
+                     i, d.events, d.busy.count(), d.max.count());
+    }
+    if (decode_errors_ > 0)
+        spdlog::warn("SampicCollectorModePipelined: {} decode error(s)", decode_errors_);
+
+    for (auto& s : slots_) {
+        if (s.event_buffer || s.frames)
+            SAMPIC256CH_FreeEventMemory(&s.event_buffer, &s.frames);
+    }
+}
+
+// ---------------------------------------------------------------------
+// Reader (SampicCollector thread)
+// ---------------------------------------------------------------------
+bool SampicCollectorModePipelined::collect()
+{
+    const auto t_start = std::chrono::steady_clock::now();
+    const size_t idx = static_cast<size_t>(next_read_ % slots_.size());
+    Slot& slot = slots_[idx];
+
+    // Wait for the next slot in ring order; it frees once its previous
+    // occupant is published, which happens strictly in read order.
+    {
+        std::unique_lock<std::mutex> lock(mtx_);
+        if (slot.state != SlotState::FREE) {
+            const bool freed = free_cv_.wait_for(lock, std::chrono::milliseconds(100), [&] {
+                return slot.state == SlotState::FREE || stopping_;
+            });
+            reader_stall_ += usSince(t_start);
+            if (!freed || stopping_)
+                return true;
+        }
+    }
+
+    // The reader owns a FREE slot until it is queued
+    SAMPIC256CH_PrepareEvent(&info_, &params_);
+    const auto t_after_prepare = std::chrono::steady_clock::now();
+
+    SampicTimingBreakdown timing{};
+    SAMPIC256CH_ErrCode errCode = SAMPIC256CH_NoFrameRead;
+    int nframes = 0;
+    int dummy = 0;
+    int nloop = 0;
+
+    // ---------------------------------------------------------------------
+    // Acquisition loop (read only; decoding happens on the decoder threads)
+    // ---------------------------------------------------------------------
+    while (errCode != SAMPIC256CH_Success)
+    {
+        const auto t_read_start = std::chrono::steady_clock::now();
+        errCode = SAMPIC256CH_ReadEventBuffer(&info_, dummy, slot.event_buffer, slot.frames, &nframes);
+        timing.read += usSince(t_read_start);
+
+        if (errCode == SAMPIC256CH_AcquisitionError || errCode == SAMPIC256CH_ErrInvalidEvent)
+        {
+            spdlog::error("SAMPIC pipelined mode: acquisition error (errCode={})",
+                          static_cast<int>(errCode));
+            return false;
+        }
+        if (errCode == SAMPIC256CH_Success) {
+            recordRaw(slot.frames, nframes, t_read_start, std::chrono::steady_clock::now());
+            break;
+        }
+
+        if ((nloop % mode_cfg_.soft_trigger_prepare_interval) == 0)
+            SAMPIC256CH_PrepareEvent(&info_, &params_);
+
+        ++nloop;
+
+        if (nloop > mode_cfg_.soft_trigger_max_loops)
+        {
+            spdlog::warn("SAMPIC pipelined mode: timeout after {} loops", nloop);
+            return true;
+        }
+
+        if (mode_cfg_.soft_trigger_retry_sleep_us > 0)
+            std::this_thread::sleep_for(std::chrono::microseconds(mode_cfg_.soft_trigger_retry_sleep_us));
+    }
+
+    timing.prepare = std::chrono::duration_cast<std::chrono::microseconds>(t_after_prepare - t_start);
+
+    reader_stats_.events++;
+    reader_stats_.busy += timing.read;
+    reader_stats_.max = std::max(reader_stats_.max, timing.read);
+
+    // ---------------------------------------------------------------------
+    // Hand the slot to the decoder pool, with its own copy of the crate state
+    // ---------------------------------------------------------------------
+    slot.info   = info_;
+    slot.params = params_;
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+        slot.nframes = nframes;
+        slot.timing  = timing;
+        slot.t_start = t_start;
+        slot.seq     = next_read_++;
+        slot.state   = SlotState::READ;
+        queue_.push_back(idx);
+    }
+    work_cv_.notify_one();
+
+    spdlog::trace("SAMPIC pipelined mode: queued slot {} ({} frames, prepare={}us, read={}us)",
+                  idx, nframes, timing.prepare.count(), timing.read.count());
+    return true;
+}
+
+// ---------------------------------------------------------------------
+// Decoders
+// ---------------------------------------------------------------------
+void SampicCollectorModePipelined::decodeLoop(int index)
+{
+    while (true)
+    {
+        size_t idx = 0;
+        {
+            std::unique_lock<std::mutex> lock(mtx_);
+            work_cv_.wait(lock, [&] { return stopping_ || !queue_.empty(); });
+            // Slots already read are decoded and published before exiting
+            if (queue_.empty())
+                return;
+            idx = queue_.front();
+            queue_.pop_front();
+        }
+
+        // The slot is READ and owned by this decoder until marked DONE
+        Slot& slot = slots_[idx];
+        auto ev_data = acquireEventStruct();
+        int numberOfHits = 0;
+
+        const auto t_decode_start = std::chrono::steady_clock::now();
+        const SAMPIC256CH_ErrCode errCode = SAMPIC256CH_DecodeEvent(
+            &slot.info, &slot.params, slot.frames, ev_data.get(), slot.nframes, &numberOfHits);
+        const auto decode_us = usSince(t_decode_start);
+
+        SampicTimingBreakdown timing = slot.timing;
+        timing.decode  = decode_us;
+        timing.decoder = index;
+        timing.total   = usSince(slot.t_start);
+
+        std::shared_ptr<SampicEvent> result;
+        if (errCode == SAMPIC256CH_Success && numberOfHits > 0)
+            result = makeEvent(std::move(ev_data), timing);
+
+        std::unique_lock<std::mutex> lock(mtx_);
+        auto& st = decoder_stats_[index];
+        st.events++;
+        st.busy += decode_us;
+        st.max = std::max(st.max, decode_us);
+
+        if (errCode != SAMPIC256CH_Success) {
+            const uint64_t n = ++decode_errors_;
+            if ((n & (n - 1)) == 0) // log at powers of two to avoid flooding
+                spdlog::warn("SAMPIC pipelined mode: decoder {} failed (errCode={}), {} error(s) so far",
+                             index, static_cast<int>(errCode), n);
+        }
+
+        slot.result = std::move(result);
+        slot.state  = SlotState::DONE;
+        publishReady(lock);
+    }
+}
+
+void SampicCollectorModePipelined::publishReady(std::unique_lock<std::mutex>& lock)
+{
+    // One publisher at a time keeps pushes in read order; the others leave
+    // their DONE slots to it
+    if (publishing_)
+        return;
+    publishing_ = true;
+
+    std::vector<std::shared_ptr<SampicEvent>> ready;
+    while (true)
+    {
+        // Take every consecutive DONE slot; the slots free right away
+        const uint64_t first = next_publish_;
+        while (true)
+        {
+            Slot& slot = slots_[next_publish_ % slots_.size()];
+            if (slot.state != SlotState::DONE || slot.seq != next_publish_)
+                break;
+            if (slot.result)
+                ready.push_back(std::move(slot.result));
+            slot.state = SlotState::FREE;
+            ++next_publish_;
+        }
+        // Wake the reader for freed slots even if none had a result
+        if (next_publish_ != first)
+            free_cv_.notify_one();
+        if (ready.empty())
+            break;
+
+        // Push without mtx_, so a blocking buffer stalls neither the reader nor the other decoders
+        lock.unlock();
+        for (auto& ev : ready) {
+            spdlog::debug("SAMPIC pipelined mode: collected {} hits "
+                          "(prepare={}us, read={}us, decode={}us on decoder {}, total={}us)",
+                          ev->numHits(),
+                          ev->timing().prepare.count(),
+                          ev->timing().read.count(),
+                          ev->timing().decode.count(),
+                          ev->timing().decoder,
+                          ev->timing().total.count());
+            buffer_.push(ev);
+        }
+        ready.clear();
+        lock.lock();
+    }
+    publishing_ = false;
+}
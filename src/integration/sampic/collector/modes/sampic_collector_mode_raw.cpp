@@ -0,0 +1,106 @@
+#include "integration/sampic/collector/modes/sampic_collector_mode_raw.h"
+#include "integration/sampic/collector/sampic_event.h"
+
+#include <spdlog/spdlog.h>
+#include <thread>
+#include <chrono>
+
+SampicCollectorModeRaw::SampicCollectorModeRaw(
+    SampicEventBuffer& buffer,
+    CrateInfoStruct& info,
+    CrateParamStruct& params,
+    void* eventBuffer,
+    ML_Frame* mlFrames,
+    const SampicCollectorConfig& cfg)
+    : SampicCollectorMode(buffer, info, params, eventBuffer, mlFrames, cfg),
+      mode_cfg_(cfg.raw_mode)
+{
+    spdlog::info("SampicCollectorModeRaw initialized: "
+                 "soft_trigger_prepare_interval={}, "
+                 "soft_trigger_max_loops={}, "
+                 "soft_trigger_retry_sleep_us={}, "
+                 "ML_Frame size={} bytes",
+                 mode_cfg_.soft_trigger_prepare_interval,
+                 mode_cfg_.soft_trigger_max_loops,
+                 mode_cfg_.soft_trigger_retry_sleep_us,
+                 sizeof(ML_Frame));
+}
+
+bool SampicCollectorModeRaw::collect()
+{
+    SampicTimingBreakdown timing{};
+
+    const auto t_start = std::chrono::steady_clock::now();
+    SAMPIC256CH_PrepareEvent(&info_, &params_);
+    const auto t_after_prepare = std::chrono::steady_clock::now();
+
+    SAMPIC256CH_ErrCode errCode = SAMPIC256CH_NoFrameRead;
+    int nframes = 0;
+    int dummy = 0;
+    int nloop = 0;
+
+    // ---------------------------------------------------------------------
+    // Acquisition loop (same retry policy as the default mode, minus decode)
+    // ---------------------------------------------------------------------
+    while (errCode != SAMPIC256CH_Success)
+    {
+        const auto t_read_start = std::chrono::steady_clock::now();
+        errCode = SAMPIC256CH_ReadEventBuffer(&info_, dummy, eventBuffer_, mlFrames_, &nframes);
+        const auto t_read_end = std::chrono::steady_clock::now();
+
+        timing.read += std::chrono::duration_cast<std::chrono::microseconds>(t_read_end - t_read_start);
+
+        if (errCode == SAMPIC256CH_AcquisitionError || errCode == SAMPIC256CH_ErrInvalidEvent)
+        {
+            spdlog::error("SAMPIC raw mode: acquisition error (errCode={})",
+                          static_cast<int>(errCode));
+            return false;
+        }
+
+        if (errCode == SAMPIC256CH_Success) {
+            recordRaw(mlFrames_, nframes, t_read_start, t_read_end);
+            break;
+        }
+
+        if ((nloop % mode_cfg_.soft_trigger_prepare_interval) == 0)
+            SAMPIC256CH_PrepareEvent(&info_, &params_);
+
+        ++nloop;
+
+        if (nloop > mode_cfg_.soft_trigger_max_loops)
+        {
+            spdlog::warn("SAMPIC raw mode: timeout after {} loops", nloop);
+            return true;
+        }
+
+        if (mode_cfg_.soft_trigger_retry_sleep_us > 0)
+            std::this_thread::sleep_for(std::chrono::microseconds(mode_cfg_.soft_trigger_retry_sleep_us));
+    }
+
+    if (nframes <= 0)
+        return true;
+
+    // ---------------------------------------------------------------------
+    // Copy the frames out before the next read reuses mlFrames_
+    // ---------------------------------------------------------------------
+    const auto t_copy_start = std::chrono::steady_clock::now();
+    auto raw = std::make_shared<const SampicRawFrames>(
+        mlFrames_, nframes, sequence_++,
+        static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            t_copy_start.time_since_epoch()).count()),
+        static_cast<uint32_t>(timing.read.count()));
+    const auto t_end = std::chrono::steady_clock::now();
+
+    timing.prepare = std::chrono::duration_cast<std::chrono::microseconds>(t_after_prepare - t_start);
+    timing.total   = std::chrono::duration_cast<std::chrono::microseconds>(t_end - t_start);
+
+    auto ev = std::make_shared<SampicEvent>(nullptr, timing, t_end);
+    ev->setRawFrames(std::move(raw));
+    buffer_.push(ev);
+
+    spdlog::debug("SAMPIC raw mode: read {} frames ({} bytes, prepare={}us, read={}us, total={}us)",
+                  nframes, ev->rawFrames()->size(),
+                  timing.prepare.count(), timing.read.count(), timing.total.count());
+
+    return true;
+}
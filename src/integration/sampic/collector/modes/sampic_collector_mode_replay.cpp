@@ -0,0 +1,118 @@
+#include "integration/sampic/collector/modes/sampic_collector_mode_replay.h"
+#include "integration/sampic/collector/sampic_event.h"
+
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <thread>
+
+SampicCollectorModeReplay::SampicCollectorModeReplay(
+    SampicEventBuffer& buffer,
+    CrateInfoStruct& info,
+    CrateParamStruct& params,
+    void* eventBuffer,
+    ML_Frame* mlFrames,
+    const SampicCollectorConfig& cfg)
+    : SampicCollectorMode(buffer, info, params, eventBuffer, mlFrames, cfg),
+      mode_cfg_(cfg.replay_mode)
+{
+    reader_ = std::make_unique<SampicRawReader>(mode_cfg_.file);
+
+    spdlog::info("SampicCollectorModeReplay initialized: file={}, speed={}, loop={}",
+                 mode_cfg_.file, mode_cfg_.speed, mode_cfg_.loop);
+}
+
+bool SampicCollectorModeReplay::due(const SampicRawFrameHeader& hdr)
+{
+    if (!started_) {
+        started_      = true;
+        first_ts_ns_  = hdr.read_timestamp_ns;
+        replay_start_ = std::chrono::steady_clock::now();
+        return true;
+    }
+    if (mode_cfg_.speed <= 0.0 || hdr.read_timestamp_ns <= first_ts_ns_)
+        return true;
+
+    const double offset_ns = static_cast<double>(hdr.read_timestamp_ns - first_ts_ns_) / mode_cfg_.speed;
+    const auto target = replay_start_ + std::chrono::nanoseconds(static_cast<int64_t>(offset_ns));
+
+    // Sleep at most kMaxPaceSleep per call, so a long recorded gap does not hold up stop()
+    const auto now = std::chrono::steady_clock::now();
+    if (now >= target)
+        return true;
+    std::this_thread::sleep_for(std::min<std::chrono::steady_clock::duration>(target - now, kMaxPaceSleep));
+    return std::chrono::steady_clock::now() >= target;
+}
+
+bool SampicCollectorModeReplay::collect()
+{
+    if (finished_) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        return true;
+    }
+
+    // ---------------------------------------------------------------------
+    // Next record (file I/O is accounted as "read" time), unless the last
+    // one is still waiting to be due
+    // ---------------------------------------------------------------------
+    if (!pending_) {
+        const auto t_read_start = std::chrono::steady_clock::now();
+        bool ok = reader_->next(hdr_, frames_);
+        // Loop only over a clean end of file; a damaged record ends the replay
+        if (!ok && reader_->atEnd() && mode_cfg_.loop && replayed_ > 0) {
+            ++passes_;
+            reader_->rewind();
+            started_ = false;  // restart pacing from the first record
+            ok = reader_->next(hdr_, frames_);
+        }
+        read_time_ = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - t_read_start);
+
+        if (!ok) {
+            finished_ = true;
+            if (reader_->atEnd())
+                spdlog::info("SAMPIC replay mode: end of {} after {} readouts", mode_cfg_.file, replayed_);
+            else
+                spdlog::error("SAMPIC replay mode: damaged record in {} after {} readouts; replay stopped",
+                              mode_cfg_.file, replayed_);
+            return reader_->atEnd();
+        }
+        pending_ = true;
+    }
+
+    if (!due(hdr_))
+        return true;
+    pending_ = false;
+    SampicTimingBreakdown timing{};
+
+    // ---------------------------------------------------------------------
+    // Decode and push, as in the default mode
+    // ---------------------------------------------------------------------
+    auto ev_data = acquireEventStruct();
+    int numberOfHits = 0;
+
+    const auto t_decode_start = std::chrono::steady_clock::now();
+    const SAMPIC256CH_ErrCode errCode =
+        SAMPIC256CH_DecodeEvent(&info_, &params_, frames_.data(), ev_data.get(),
+                                static_cast<int>(hdr_.nframes), &numberOfHits);
+    const auto t_decode_end = std::chrono::steady_clock::now();
+
+    timing.read   = read_time_;
+    timing.decode = std::chrono::duration_cast<std::chrono::microseconds>(t_decode_end - t_decode_start);
+    timing.total  = timing.read + timing.decode;
+    ++replayed_;
+
+    if (errCode != SAMPIC256CH_Success) {
+        spdlog::error("SAMPIC replay mode: decode failed for record {} (errCode={})",
+                      hdr_.sequence, static_cast<int>(errCode));
+        return false;
+    }
+
+    if (numberOfHits > 0)
+        pushEvent(std::move(ev_data), timing);
+
+    spdlog::debug("SAMPIC replay mode: record {} ({} frames, {} hits, pass {}, read={}us, decode={}us)",
+                  hdr_.sequence, hdr_.nframes, numberOfHits, passes_,
+                  timing.read.count(), timing.decode.count());
+
+    return true;
+}
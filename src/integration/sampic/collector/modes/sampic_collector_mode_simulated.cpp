@@ -0,0 +1,175 @@
+#include "integration/sampic/collector/modes/sampic_collector_mode_simulated.h"
+#include "integration/sampic/collector/sampic_event.h"
+
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <type_traits>
+
+namespace {
+
+constexpr int kChannelsPerBoard = 64;
+constexpr int kChannelsPerChip  = 16;
+constexpr size_t kNoiseTableSize = 1 << 16;
+
+/// Number of HitStruct slots in one EventStruct.
+constexpr int kEventCapacity = static_cast<int>(sizeof(EventStruct::Hit) / sizeof(HitStruct));
+
+/// Number of sample cells in one HitStruct waveform.
+constexpr int kSampleCapacity =
+    static_cast<int>(std::extent_v<decltype(HitStruct::CorrectedDataSamples)>);
+
+using RawSample = std::remove_all_extents_t<decltype(HitStruct::OrderedRawDataSamples)>;
+
+/// Map a voltage onto an 11-bit ADC code spanning [-0.5 V, 0.5 V).
+RawSample toAdcCode(float v) {
+    const long code = std::lround((static_cast<double>(v) + 0.5) * 2048.0);
+    return static_cast<RawSample>(std::clamp(code, 0L, 2047L));
+}
+
+} // namespace
+
+SampicCollectorModeSimulated::SampicCollectorModeSimulated(
+    SampicEventBuffer& buffer,
+    CrateInfoStruct& info,
+    CrateParamStruct& params,
+    void* eventBuffer,
+    ML_Frame* mlFrames,
+    const SampicCollectorConfig& cfg)
+    : SampicCollectorMode(buffer, info, params, eventBuffer, mlFrames, cfg),
+      mode_cfg_(cfg.simulated_mode)
+{
+    // ---------------------------------------------------------------------
+    // Active channel set
+    // ---------------------------------------------------------------------
+    const int total_channels = std::max(1, mode_cfg_.num_boards) * kChannelsPerBoard;
+    const double occupancy = std::clamp(mode_cfg_.channel_occupancy, 0.0, 1.0);
+    const int n_active = std::max(1, static_cast<int>(std::lround(occupancy * total_channels)));
+
+    std::vector<uint16_t> all(total_channels);
+    for (int i = 0; i < total_channels; ++i)
+        all[i] = static_cast<uint16_t>(i);
+
+    std::mt19937 gen(mode_cfg_.seed);
+    std::shuffle(all.begin(), all.end(), gen);
+    active_channels_.assign(all.begin(), all.begin() + n_active);
+    std::sort(active_channels_.begin(), active_channels_.end());
+
+    // ---------------------------------------------------------------------
+    // Waveform template and noise table
+    // ---------------------------------------------------------------------
+    samples_per_hit_ = std::clamp(mode_cfg_.samples_per_hit, 1, kSampleCapacity);
+    peak_index_ = samples_per_hit_ / 3;
+
+    pulse_template_.resize(samples_per_hit_);
+    const double rise  = std::max(1.0, samples_per_hit_ / 16.0);
+    const double decay = std::max(2.0, samples_per_hit_ / 6.0);
+    for (int i = 0; i < samples_per_hit_; ++i) {
+        const double x = static_cast<double>(i - peak_index_);
+        const double shape = (x < 0) ? std::exp(-0.5 * (x / rise) * (x / rise))
+                                     : std::exp(-x / decay);
+        pulse_template_[i] = static_cast<float>(mode_cfg_.baseline_v - mode_cfg_.amplitude_v * shape);
+    }
+
+    noise_table_.resize(kNoiseTableSize + samples_per_hit_);
+    std::normal_distribution<float> noise(0.0f, static_cast<float>(mode_cfg_.noise_rms_v));
+    for (auto& n : noise_table_)
+        n = noise(gen);
+
+    // ---------------------------------------------------------------------
+    // Rate and timestamp parameters
+    // ---------------------------------------------------------------------
+    max_hits_per_event_ = (mode_cfg_.max_hits_per_event > 0)
+                              ? std::min(mode_cfg_.max_hits_per_event, kEventCapacity)
+                              : kEventCapacity;
+
+    spacing_ns_ = (mode_cfg_.timestamp_spacing_ns > 0.0)
+                      ? mode_cfg_.timestamp_spacing_ns
+                      : (mode_cfg_.hit_rate_hz > 0.0 ? 1e9 / mode_cfg_.hit_rate_hz : 1000.0);
+    sampling_period_ns_ = 1e3 / std::max(1, mode_cfg_.sampling_frequency_mhz);
+
+    rng_state_ = (static_cast<uint64_t>(mode_cfg_.seed) << 1) | 1u;
+    last_collect_ = std::chrono::steady_clock::now();
+
+    spdlog::info("SampicCollectorModeSimulated initialized: "
+                 "hit_rate_hz={}, active_channels={}/{}, samples_per_hit={}, "
+                 "timestamp_spacing_ns={}, max_hits_per_event={}",
+                 mode_cfg_.hit_rate_hz, n_active, total_channels,
+                 samples_per_hit_, spacing_ns_, max_hits_per_event_);
+}
+
+uint64_t SampicCollectorModeSimulated::nextRandom()
+{
+    rng_state_ ^= rng_state_ >> 12;
+    rng_state_ ^= rng_state_ << 25;
+    rng_state_ ^= rng_state_ >> 27;
+    return rng_state_ * 0x2545F4914F6CDD1DULL;
+}
+
+void SampicCollectorModeSimulated::fillHit(HitStruct& hit, uint16_t global_channel)
+{
+    const int board   = global_channel / kChannelsPerBoard;
+    const int channel = global_channel % kChannelsPerBoard;
+
+    hit.FeBoardIndex       = board;
+    hit.SampicIndex        = channel / kChannelsPerChip;
+    hit.Channel            = channel;
+    hit.HitNumber          = hit_number_++;
+    hit.DataSize           = samples_per_hit_;
+    hit.FirstCellTimeStamp = sim_time_ns_;
+    hit.TimeInstant        = sim_time_ns_ + peak_index_ * sampling_period_ns_;
+    hit.Baseline           = mode_cfg_.baseline_v;
+    hit.Amplitude          = mode_cfg_.amplitude_v;
+    hit.Peak               = mode_cfg_.baseline_v - mode_cfg_.amplitude_v;
+
+    const float* noise = noise_table_.data() + (nextRandom() % kNoiseTableSize);
+    for (int s = 0; s < samples_per_hit_; ++s) {
+        const float v = pulse_template_[s] + noise[s];
+        hit.CorrectedDataSamples[s]  = v;
+        hit.OrderedRawDataSamples[s] = toAdcCode(v);
+        hit.RawDataSamples[s]        = hit.OrderedRawDataSamples[s];
+    }
+}
+
+bool SampicCollectorModeSimulated::collect()
+{
+    SampicTimingBreakdown timing{};
+    const auto t_start = std::chrono::steady_clock::now();
+
+    // ---------------------------------------------------------------------
+    // Determine how many hits are due since the previous call
+    // ---------------------------------------------------------------------
+    const double elapsed_s = std::chrono::duration<double>(t_start - last_collect_).count();
+    last_collect_ = t_start;
+    hit_credit_ += mode_cfg_.hit_rate_hz * elapsed_s;
+
+    const int n_hits = static_cast<int>(std::min<double>(std::floor(hit_credit_), max_hits_per_event_));
+    if (n_hits <= 0)
+        return true;
+    hit_credit_ -= n_hits;
+
+    // ---------------------------------------------------------------------
+    // Synthesize hits (accounted as "decode" time)
+    // ---------------------------------------------------------------------
+    auto ev_data = acquireEventStruct();
+    const auto t_fill_start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < n_hits; ++i) {
+        const uint16_t ch = active_channels_[nextRandom() % active_channels_.size()];
+        fillHit(ev_data->Hit[i], ch);
+        sim_time_ns_ += spacing_ns_;
+    }
+    ev_data->NbOfHitsInEvent = n_hits;
+
+    const auto t_fill_end = std::chrono::steady_clock::now();
+    timing.decode = std::chrono::duration_cast<std::chrono::microseconds>(t_fill_end - t_fill_start);
+    timing.total  = std::chrono::duration_cast<std::chrono::microseconds>(t_fill_end - t_start);
+
+    pushEvent(std::move(ev_data), timing);
+
+    spdlog::debug("SAMPIC simulated mode: generated {} hits (fill={}us, backlog={:.0f} hits)",
+                  n_hits, timing.decode.count(), hit_credit_);
+
+    return true;
+}
@@ -1,6 +1,15 @@
 #include "integration/sampic/collector/sampic_collector.h"
+#include "integration/sampic/collector/buffers/sampic_event_buffer_default.h"
+#include "integration/sampic/collector/buffers/sampic_event_buffer_spsc_ring.h"
 #include "integration/sampic/collector/modes/sampic_collector_mode_default.h"
 #include "integration/sampic/collector/modes/sampic_collector_mode_example.h"
+#include "integration/sampic/collector/modes/sampic_collector_mode_simulated.h"
+#include "integration/sampic/collector/modes/sampic_collector_mode_pipelined.h"
+#include "integration/sampic/collector/modes/sampic_collector_mode_raw.h"
+#include "integration/sampic/collector/modes/sampic_collector_mode_replay.h"
+
+#include <ctime>
+#include <filesystem>
 
 SampicCollector::SampicCollector(const SampicCollectorConfig& cfg,
                                  CrateInfoStruct& info,
@@ -14,8 +23,9 @@ SampicCollector::SampicCollector(const SampicCollectorConfig& cfg,
       mlFrames_(mlFrames)
 {
     buildMode();
-    spdlog::info("SAMPIC Collector initialized (mode={}, buffer_size={})",
-                 static_cast<int>(cfg_.mode), cfg_.buffer_size);
+    spdlog::info("SAMPIC Collector initialized (mode={}, buffer_type={}, buffer_size={}, overflow_policy={}, event_pool={})",
+                 static_cast<int>(cfg_.mode), static_cast<int>(cfg_.buffer_type), buffer_->capacity(),
+                 static_cast<int>(cfg_.buffer_overflow.policy), pool_ ? pool_->capacity() : 0);
 }
 
 SampicCollector::~SampicCollector() {
@@ -23,7 +33,30 @@ SampicCollector::~SampicCollector() {
 }
 
 void SampicCollector::buildMode() {
-    buffer_ = std::make_unique<SampicEventBuffer>(cfg_.buffer_size);
+    // Destroy the old mode first: it may own threads that still push into buffer_
+    mode_.reset();
+
+    switch (cfg_.buffer_type) {
+        case SampicEventBufferType::DEFAULT:
+            buffer_ = std::make_unique<SampicEventBufferDefault>(cfg_.buffer_size, cfg_.buffer_overflow);
+            break;
+        case SampicEventBufferType::SPSC_RING:
+            buffer_ = std::make_unique<SampicEventBufferSpscRing>(cfg_.buffer_size, cfg_.buffer_overflow);
+            break;
+        default:
+            throw std::runtime_error("Unsupported SampicEventBufferType");
+    }
+
+    // Keep an existing pool of the right size: preallocation is costly and
+    // slots still referenced from the previous run return to it when released.
+    if (cfg_.use_event_pool) {
+        const size_t pool_size = cfg_.event_pool_size > 0 ? cfg_.event_pool_size
+                                                          : buffer_->capacity() + 8;
+        if (!pool_ || pool_->capacity() != pool_size)
+            pool_ = std::make_shared<SampicEventPool>(pool_size);
+    } else {
+        pool_.reset();
+    }
 
     switch (cfg_.mode) {
         case SampicCollectorModeType::DEFAULT:
@@ -34,9 +67,26 @@ void SampicCollector::buildMode() {
             mode_ = std::make_unique<SampicCollectorModeExample>(
                 *buffer_, info_, params_, eventBuffer_, mlFrames_, cfg_);
             break;
+        case SampicCollectorModeType::SIMULATED:
+            mode_ = std::make_unique<SampicCollectorModeSimulated>(
+                *buffer_, info_, params_, eventBuffer_, mlFrames_, cfg_);
+            break;
+        case SampicCollectorModeType::PIPELINED:
+            mode_ = std::make_unique<SampicCollectorModePipelined>(
+                *buffer_, info_, params_, eventBuffer_, mlFrames_, cfg_);
+            break;
+        case SampicCollectorModeType::RAW:
+            mode_ = std::make_unique<SampicCollectorModeRaw>(
+                *buffer_, info_, params_, eventBuffer_, mlFrames_, cfg_);
+            break;
+        case SampicCollectorModeType::REPLAY:
+            mode_ = std::make_unique<SampicCollectorModeReplay>(
+                *buffer_, info_, params_, eventBuffer_, mlFrames_, cfg_);
+            break;
         default:
             throw std::runtime_error("Unsupported SampicCollectorModeType");
     }
+    mode_->setEventPool(pool_);
 }
 
 void SampicCollector::setConfig(const SampicCollectorConfig& cfg) {
@@ -49,8 +99,9 @@ int SampicCollector::applySettings() {
 
     try {
         buildMode();
-        spdlog::info("SAMPIC Collector reconfigured (mode={}, buffer_size={})",
-                     static_cast<int>(cfg_.mode), cfg_.buffer_size);
+        spdlog::info("SAMPIC Collector reconfigured (mode={}, buffer_type={}, buffer_size={}, overflow_policy={}, event_pool={})",
+                     static_cast<int>(cfg_.mode), static_cast<int>(cfg_.buffer_type), buffer_->capacity(),
+                     static_cast<int>(cfg_.buffer_overflow.policy), pool_ ? pool_->capacity() : 0);
 
         if (was_running) start();
         return 0;
@@ -62,6 +113,7 @@ int SampicCollector::applySettings() {
 
 void SampicCollector::start() {
     if (running_) return;
+    openRecorder();
     running_ = true;
     worker_ = std::thread(&SampicCollector::run, this);
 }
@@ -71,9 +123,42 @@ void SampicCollector::stop() {
         running_ = false;
         if (worker_.joinable())
             worker_.join();
+        closeRecorder();
     }
 }
 
+void SampicCollector::openRecorder() {
+    if (cfg_.raw_record_dir.empty() || cfg_.mode == SampicCollectorModeType::REPLAY ||
+        cfg_.mode == SampicCollectorModeType::SIMULATED)
+        return;
+
+    const std::time_t now = std::time(nullptr);
+    char stamp[32];
+    std::strftime(stamp, sizeof(stamp), "%Y%m%d_%H%M%S", std::localtime(&now));
+    const std::string path =
+        (std::filesystem::path(cfg_.raw_record_dir) / (std::string("sampic_raw_") + stamp + ".sprf")).string();
+
+    try {
+        std::filesystem::create_directories(cfg_.raw_record_dir);
+        recorder_ = std::make_shared<SampicRawRecorder>(path);
+        mode_->setRawRecorder(recorder_);
+        spdlog::info("SAMPIC Collector recording raw reads to {}", path);
+    } catch (const std::exception& e) {
+        spdlog::error("SAMPIC Collector: raw recording disabled: {}", e.what());
+        recorder_.reset();
+    }
+}
+
+void SampicCollector::closeRecorder() {
+    if (!recorder_)
+        return;
+    mode_->setRawRecorder(nullptr);
+    recorder_->close();
+    spdlog::info("SAMPIC Collector raw recording closed ({} records, {:.1f} MB, {})",
+                 recorder_->records(), recorder_->bytes() / 1e6, recorder_->path());
+    recorder_.reset();
+}
+
 void SampicCollector::run() {
     spdlog::info("SAMPIC Collector started (mode={})", static_cast<int>(cfg_.mode));
 
@@ -86,5 +171,13 @@ void SampicCollector::run() {
             std::this_thread::sleep_for(std::chrono::microseconds(cfg_.sleep_time_us));
     }
 
-    spdlog::info("SAMPIC Collector stopped");
+    const BufferStats st = buffer_->stats();
+    spdlog::info("SAMPIC Collector stopped (pushed={}, dropped_events={}, dropped_hits={}, high_water={}/{})",
+                 st.pushed, st.dropped_events, st.dropped_hits, st.high_water_mark, st.capacity);
+
+    if (pool_) {
+        const SampicEventPoolStats ps = pool_->stats();
+        spdlog::info("SAMPIC Collector event pool: capacity={}, acquired={}, exhausted={}, high_water={}",
+                     ps.capacity, ps.acquired, ps.exhausted, ps.in_use_high_water);
+    }
 }
@@ -6,6 +6,12 @@ SampicEvent::SampicEvent(std::shared_ptr<EventStruct> data,
                          std::chrono::steady_clock::time_point ts)
     : data_(std::move(data)), timing_(timing), timestamp_(ts) {}
 
+SampicEvent::SampicEvent(std::shared_ptr<EventStruct> data,
+                         std::shared_ptr<const SampicHitTable> hits,
+                         const SampicTimingBreakdown& timing,
+                         std::chrono::steady_clock::time_point ts)
+    : data_(std::move(data)), hits_(std::move(hits)), timing_(timing), timestamp_(ts) {}
+
 SampicEvent::~SampicEvent() = default;
 
 // ------------------------------------------------------------------
@@ -27,6 +33,22 @@ const std::shared_ptr<EventStruct>& SampicEvent::data() const {
     return data_;
 }
 
+void SampicEvent::setHitTable(const std::shared_ptr<const SampicHitTable>& hits) {
+    hits_ = hits;
+}
+
+const std::shared_ptr<const SampicHitTable>& SampicEvent::hitTable() const {
+    return hits_;
+}
+
+void SampicEvent::setRawFrames(const std::shared_ptr<const SampicRawFrames>& raw) {
+    raw_ = raw;
+}
+
+const std::shared_ptr<const SampicRawFrames>& SampicEvent::rawFrames() const {
+    return raw_;
+}
+
 void SampicEvent::setTiming(const SampicTimingBreakdown& timing) {
     timing_ = timing;
 }
@@ -50,7 +72,9 @@ bool SampicEvent::consumed() const {
 // Derived Info
 // ------------------------------------------------------------------
 int SampicEvent::numHits() const {
-    return data_ ? data_->NbOfHitsInEvent : 0;
+    if (data_)
+        return data_->NbOfHitsInEvent;
+    return hits_ ? static_cast<int>(hits_->size()) : 0;
 }
 
 std::string SampicEvent::summary() const {
@@ -0,0 +1,57 @@
+#include "integration/sampic/collector/sampic_event_pool.h"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+
+SampicEventPool::SampicEventPool(size_t capacity)
+    : capacity_(capacity),
+      storage_(capacity > 0 ? new EventStruct[capacity]() : nullptr)  // value-init faults pages in now
+{
+    free_.reserve(capacity_);
+    for (size_t i = capacity_; i-- > 0;)
+        free_.push_back(&storage_[i]);
+
+    spdlog::debug("SampicEventPool: preallocated {} EventStruct slots ({} MB)",
+                  capacity_, (capacity_ * sizeof(EventStruct)) >> 20);
+}
+
+std::shared_ptr<EventStruct> SampicEventPool::acquire() {
+    EventStruct* slot = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+        if (!free_.empty()) {
+            slot = free_.back();
+            free_.pop_back();
+            in_use_high_water_ = std::max(in_use_high_water_, capacity_ - free_.size());
+        }
+    }
+
+    if (!slot) {
+        const uint64_t n = exhausted_.fetch_add(1, std::memory_order_relaxed) + 1;
+        if ((n & (n - 1)) == 0) // log at powers of two to avoid flooding
+            spdlog::warn("SampicEventPool: all {} slots in use, {} heap fallback(s) so far",
+                         capacity_, n);
+        return std::make_shared<EventStruct>();
+    }
+
+    acquired_.fetch_add(1, std::memory_order_relaxed);
+    return std::shared_ptr<EventStruct>(slot, [self = shared_from_this()](EventStruct* p) {
+        self->release(p);
+    });
+}
+
+void SampicEventPool::release(EventStruct* slot) {
+    std::lock_guard<std::mutex> lock(mtx_);
+    free_.push_back(slot);
+}
+
+SampicEventPoolStats SampicEventPool::stats() const {
+    SampicEventPoolStats s;
+    s.capacity  = capacity_;
+    s.acquired  = acquired_.load(std::memory_order_relaxed);
+    s.exhausted = exhausted_.load(std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> lock(mtx_);
+    s.available         = free_.size();
+    s.in_use_high_water = in_use_high_water_;
+    return s;
+}
@@ -0,0 +1,56 @@
+#include "integration/sampic/collector/sampic_hit_table.h"
+#include <algorithm>
+#include <type_traits>
+
+namespace {
+
+/// Number of sample cells in one HitStruct waveform.
+constexpr int kSampleCapacity =
+    static_cast<int>(std::extent_v<decltype(HitStruct::CorrectedDataSamples)>);
+
+} // namespace
+
+SampicHitTable::SampicHitTable(const EventStruct& ev)
+{
+    const size_t n = static_cast<size_t>(std::max(0, ev.NbOfHitsInEvent));
+
+    int stride = 0;
+    for (size_t i = 0; i < n; ++i)
+        stride = std::max(stride, ev.Hit[i].DataSize);
+    samples_per_hit_ = static_cast<size_t>(std::clamp(stride, 0, kSampleCapacity));
+
+    first_cell_time_.resize(n);
+    time_instant_.resize(n);
+    baseline_.resize(n);
+    amplitude_.resize(n);
+    peak_.resize(n);
+    hit_number_.resize(n);
+    board_.resize(n);
+    chip_.resize(n);
+    channel_.resize(n);
+    data_size_.resize(n);
+    samples_.assign(n * samples_per_hit_, 0.0f);
+
+    for (size_t i = 0; i < n; ++i) {
+        const HitStruct& h = ev.Hit[i];
+        first_cell_time_[i] = h.FirstCellTimeStamp;
+        time_instant_[i]    = h.TimeInstant;
+        baseline_[i]        = static_cast<float>(h.Baseline);
+        amplitude_[i]       = static_cast<float>(h.Amplitude);
+        peak_[i]            = static_cast<float>(h.Peak);
+        hit_number_[i]      = static_cast<int32_t>(h.HitNumber);
+        board_[i]           = static_cast<uint16_t>(h.FeBoardIndex);
+        chip_[i]            = static_cast<uint16_t>(h.SampicIndex);
+        channel_[i]         = static_cast<uint16_t>(h.Channel);
+
+        const size_t len = static_cast<size_t>(std::clamp<int>(h.DataSize, 0, static_cast<int>(samples_per_hit_)));
+        data_size_[i] = static_cast<uint16_t>(len);
+        std::copy_n(h.CorrectedDataSamples, len, samples_.data() + i * samples_per_hit_);
+    }
+}
+
+size_t SampicHitTable::memoryBytes() const {
+    const size_t n = size();
+    return n * (2 * sizeof(double) + 3 * sizeof(float) + sizeof(int32_t) + 4 * sizeof(uint16_t)) +
+           samples_.size() * sizeof(float);
+}
@@ -0,0 +1,59 @@
+#include "integration/sampic/collector/sampic_raw_frames.h"
+#include <algorithm>
+#include <cstring>
+
+SampicRawFrameHeader SampicRawFrames::makeHeader(uint32_t nframes, uint64_t sequence,
+                                                 uint64_t read_timestamp_ns, uint32_t read_us)
+{
+    SampicRawFrameHeader hdr{};
+    hdr.magic             = kSampicRawFrameMagic;
+    hdr.version           = kSampicRawFrameVersion;
+    hdr.frame_struct_size = static_cast<uint16_t>(sizeof(ML_Frame));
+    hdr.nframes           = nframes;
+    hdr.read_us           = read_us;
+    hdr.sequence          = sequence;
+    hdr.read_timestamp_ns = read_timestamp_ns;
+    return hdr;
+}
+
+SampicRawFrames::SampicRawFrames(const ML_Frame* frames, int nframes,
+                                 uint64_t sequence, uint64_t read_timestamp_ns, uint32_t read_us)
+{
+    const uint32_t n = static_cast<uint32_t>(std::max(0, nframes));
+    const SampicRawFrameHeader hdr = makeHeader(n, sequence, read_timestamp_ns, read_us);
+
+    bytes_.resize(recordSize(n));
+    std::memcpy(bytes_.data(), &hdr, sizeof(hdr));
+    if (n > 0)
+        std::memcpy(bytes_.data() + sizeof(hdr), frames, n * sizeof(ML_Frame));
+}
+
+SampicRawFrames::SampicRawFrames(std::vector<uint8_t> bytes)
+    : bytes_(std::move(bytes)) {}
+
+SampicRawFrameHeader SampicRawFrames::header() const {
+    SampicRawFrameHeader hdr{};
+    if (bytes_.size() >= sizeof(hdr))
+        std::memcpy(&hdr, bytes_.data(), sizeof(hdr));
+    return hdr;
+}
+
+size_t SampicRawFrames::unpack(const uint8_t* data, size_t size,
+                               SampicRawFrameHeader& hdr, std::vector<ML_Frame>& frames)
+{
+    if (!data || size < sizeof(SampicRawFrameHeader))
+        return 0;
+
+    std::memcpy(&hdr, data, sizeof(hdr));
+    if (!isValid(hdr))
+        return 0;
+
+    const size_t total = recordSize(hdr.nframes);
+    if (size < total)
+        return 0;
+
+    frames.resize(hdr.nframes);
+    if (hdr.nframes > 0)
+        std::memcpy(frames.data(), data + sizeof(hdr), hdr.nframes * sizeof(ML_Frame));
+    return total;
+}
@@ -0,0 +1,149 @@
+#include "integration/sampic/collector/sampic_raw_recording.h"
+
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+
+namespace {
+constexpr size_t kStdioBufferSize = 4 << 20;
+}
+
+// ------------------------------------------------------------------
+// SampicRawRecorder
+// ------------------------------------------------------------------
+
+SampicRawRecorder::SampicRawRecorder(const std::string& path)
+    : path_(path), stdio_buffer_(kStdioBufferSize)
+{
+    file_ = std::fopen(path_.c_str(), "wb");
+    if (!file_)
+        throw std::runtime_error("SampicRawRecorder: cannot open " + path_);
+    std::setvbuf(file_, stdio_buffer_.data(), _IOFBF, stdio_buffer_.size());
+
+    SampicRawFileHeader hdr{};
+    hdr.magic             = kSampicRawFileMagic;
+    hdr.version           = kSampicRawFileVersion;
+    hdr.frame_struct_size = static_cast<uint16_t>(sizeof(ML_Frame));
+    hdr.created_unix_ns   = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count());
+
+    if (std::fwrite(&hdr, sizeof(hdr), 1, file_) != 1) {
+        std::fclose(file_);
+        file_ = nullptr;
+        throw std::runtime_error("SampicRawRecorder: cannot write header to " + path_);
+    }
+    bytes_ = sizeof(hdr);
+}
+
+SampicRawRecorder::~SampicRawRecorder() {
+    close();
+}
+
+void SampicRawRecorder::write(const ML_Frame* frames, int nframes,
+                              uint64_t read_timestamp_ns, uint32_t read_us)
+{
+    const uint32_t n = static_cast<uint32_t>(std::max(0, nframes));
+
+    std::lock_guard<std::mutex> lock(mtx_);
+    if (!file_ || write_failed_)
+        return;
+
+    const SampicRawFrameHeader hdr =
+        SampicRawFrames::makeHeader(n, records_, read_timestamp_ns, read_us);
+
+    const bool ok = std::fwrite(&hdr, sizeof(hdr), 1, file_) == 1 &&
+                    (n == 0 || std::fwrite(frames, sizeof(ML_Frame), n, file_) == n);
+    if (!ok) {
+        write_failed_ = true;
+        spdlog::error("SampicRawRecorder: write to {} failed after {} records; recording stopped",
+                      path_, records_);
+        return;
+    }
+
+    ++records_;
+    bytes_ += SampicRawFrames::recordSize(n);
+}
+
+void SampicRawRecorder::close() {
+    std::lock_guard<std::mutex> lock(mtx_);
+    if (!file_)
+        return;
+    std::fclose(file_);
+    file_ = nullptr;
+}
+
+uint64_t SampicRawRecorder::records() const {
+    std::lock_guard<std::mutex> lock(mtx_);
+    return records_;
+}
+
+uint64_t SampicRawRecorder::bytes() const {
+    std::lock_guard<std::mutex> lock(mtx_);
+    return bytes_;
+}
+
+// ------------------------------------------------------------------
+// SampicRawReader
+// ------------------------------------------------------------------
+
+SampicRawReader::SampicRawReader(const std::string& path)
+    : path_(path)
+{
+    file_ = std::fopen(path_.c_str(), "rb");
+    if (!file_)
+        throw std::runtime_error("SampicRawReader: cannot open " + path_);
+
+    if (std::fread(&file_header_, sizeof(file_header_), 1, file_) != 1 ||
+        file_header_.magic != kSampicRawFileMagic ||
+        file_header_.version != kSampicRawFileVersion) {
+        std::fclose(file_);
+        file_ = nullptr;
+        throw std::runtime_error("SampicRawReader: " + path_ + " is not a raw recording file");
+    }
+
+    if (file_header_.frame_struct_size != sizeof(ML_Frame)) {
+        std::fclose(file_);
+        file_ = nullptr;
+        throw std::runtime_error("SampicRawReader: " + path_ + " was recorded with sizeof(ML_Frame)=" +
+                                 std::to_string(file_header_.frame_struct_size) + ", expected " +
+                                 std::to_string(sizeof(ML_Frame)));
+    }
+}
+
+SampicRawReader::~SampicRawReader() {
+    if (file_)
+        std::fclose(file_);
+}
+
+bool SampicRawReader::next(SampicRawFrameHeader& hdr, std::vector<ML_Frame>& frames) {
+    at_end_ = false;
+    const size_t got = std::fread(&hdr, 1, sizeof(hdr), file_);
+    if (got == 0 && std::feof(file_)) {
+        at_end_ = true;
+        return false;
+    }
+    if (got != sizeof(hdr)) {
+        spdlog::warn("SampicRawReader: truncated record header in {}", path_);
+        return false;
+    }
+
+    if (!SampicRawFrames::isValid(hdr)) {
+        spdlog::warn("SampicRawReader: corrupt record header in {}", path_);
+        return false;
+    }
+
+    frames.resize(hdr.nframes);
+    if (hdr.nframes > 0 && std::fread(frames.data(), sizeof(ML_Frame), hdr.nframes, file_) != hdr.nframes) {
+        spdlog::warn("SampicRawReader: truncated record {} in {}", hdr.sequence, path_);
+        return false;
+    }
+    return true;
+}
+
+void SampicRawReader::rewind() {
+    at_end_ = false;
+    std::clearerr(file_);
+    std::fseek(file_, static_cast<long>(sizeof(SampicRawFileHeader)), SEEK_SET);
+}
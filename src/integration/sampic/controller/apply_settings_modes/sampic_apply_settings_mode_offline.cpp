@@ -0,0 +1,7 @@
+#include "integration/sampic/controller/apply_settings_modes/sampic_apply_settings_mode_offline.h"
+#include <spdlog/spdlog.h>
+
+void SampicApplySettingsModeOffline::apply() {
+    spdlog::info("ApplySettingsModeOffline: No crate attached, skipping hardware configuration "
+                 "({} front-end boards in settings).", settings_.front_end_boards.size());
+}
@@ -0,0 +1,27 @@
+#include "integration/sampic/controller/init_settings_modes/sampic_init_settings_mode_offline.h"
+#include <spdlog/spdlog.h>
+
+int SampicInitSettingsModeOffline::initialize() {
+    spdlog::info("InitSettingsModeOffline: Initializing SAMPIC system without crate connection...");
+
+    auto err = SAMPIC256CH_SetDefaultParameters(&info_, &params_);
+    if (err != SAMPIC256CH_Success) {
+        spdlog::warn("InitSettingsModeOffline: Failed to set default parameters (err={}), continuing anyway...",
+                     static_cast<int>(err));
+    }
+
+    err = SAMPIC256CH_LoadAllCalibValuesFromFiles(&info_, &params_,
+                                                  const_cast<char*>(settings_.calibration_directory.c_str()));
+    if (err != SAMPIC256CH_Success) {
+        spdlog::warn("InitSettingsModeOffline: Calibration files missing, continuing anyway...");
+    }
+
+    err = SAMPIC256CH_AllocateEventMemory(&eventBuffer_, &mlFrames_);
+    if (err != SAMPIC256CH_Success) {
+        spdlog::error("InitSettingsModeOffline: Failed to allocate event memory (err={})", static_cast<int>(err));
+        return err;
+    }
+    spdlog::info("InitSettingsModeOffline: Event memory allocated successfully.");
+
+    return SAMPIC256CH_Success;
+}
@@ -1,8 +1,10 @@
 #include "integration/sampic/controller/sampic_controller.h"
 #include "integration/sampic/controller/init_settings_modes/sampic_init_settings_mode_default.h"
 #include "integration/sampic/controller/init_settings_modes/sampic_init_settings_mode_example.h"
+#include "integration/sampic/controller/init_settings_modes/sampic_init_settings_mode_offline.h"
 #include "integration/sampic/controller/apply_settings_modes/sampic_apply_settings_mode_default.h"
 #include "integration/sampic/controller/apply_settings_modes/sampic_apply_settings_mode_example.h"
+#include "integration/sampic/controller/apply_settings_modes/sampic_apply_settings_mode_offline.h"
 
 SampicController::SampicController(const SampicSystemSettings& sys_cfg,
                                    const SampicControllerConfig& ctrl_cfg,
@@ -21,6 +23,10 @@ SampicController::SampicController(const SampicSystemSettings& sys_cfg,
             init_mode_ = std::make_unique<SampicInitSettingsModeExample>(
                 info_, params_, eventBuffer_, mlFrames_, settings_, ctrl_cfg_);
             break;
+        case SampicInitSettingsModeType::OFFLINE:
+            init_mode_ = std::make_unique<SampicInitSettingsModeOffline>(
+                info_, params_, eventBuffer_, mlFrames_, settings_, ctrl_cfg_);
+            break;
     }
 
     // Select apply mode
@@ -33,6 +39,10 @@ SampicController::SampicController(const SampicSystemSettings& sys_cfg,
             apply_mode_ = std::make_unique<SampicApplySettingsModeExample>(
                 info_, params_, settings_, ctrl_cfg_);
             break;
+        case SampicApplySettingsModeType::OFFLINE:
+            apply_mode_ = std::make_unique<SampicApplySettingsModeOffline>(
+                info_, params_, settings_, ctrl_cfg_);
+            break;
     }
 
     // Create collector (owns its buffer)
@@ -103,6 +113,12 @@ int SampicController::startRun() {
         return 0;
     }
 
+    if (offline()) {
+        spdlog::info("Starting SAMPIC run (offline, no crate attached)");
+        run_started_ = true;
+        return 0;
+    }
+
     spdlog::info("Starting SAMPIC run...");
     auto err = SAMPIC256CH_StartRun(&info_, &params_, TRUE);
     if (err != SAMPIC256CH_Success) {
@@ -119,6 +135,12 @@ int SampicController::stopRun() {
         return 0;
     }
 
+    if (offline()) {
+        spdlog::info("Stopping SAMPIC run (offline, no crate attached)");
+        run_started_ = false;
+        return 0;
+    }
+
     spdlog::info("Stopping SAMPIC run...");
     auto err = SAMPIC256CH_StopRun(&info_, &params_);
     if (err != SAMPIC256CH_Success) {
@@ -141,7 +163,8 @@ void SampicController::cleanup() {
         eventBuffer_ = nullptr;
         mlFrames_ = nullptr;
     }
-    SAMPIC256CH_CloseCrateConnection(&info_);
+    if (!offline())
+        SAMPIC256CH_CloseCrateConnection(&info_);
     initialized_ = false;
 }
 
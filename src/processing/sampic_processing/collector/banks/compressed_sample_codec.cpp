@@ -0,0 +1,211 @@
+#include "processing/sampic_processing/collector/banks/compressed_sample_codec.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+// LZ4 comes with MIDAS (symbols prefixed MLZ4_ to avoid clashes)
+#if __has_include(<mlz4.h>)
+#include <mlz4.h>
+#define COMPRESSED_SAMPLE_CODEC_LZ4 1
+#endif
+
+namespace {
+
+inline uint32_t zigzag(int32_t r) {
+    return (static_cast<uint32_t>(r) << 1) ^ static_cast<uint32_t>(r >> 31);
+}
+
+inline int32_t unzigzag(uint32_t z) {
+    return static_cast<int32_t>((z >> 1) ^ (0u - (z & 1u)));
+}
+
+} // namespace
+
+bool CompressedSampleCodec::lz4Available()
+{
+#ifdef COMPRESSED_SAMPLE_CODEC_LZ4
+    return true;
+#else
+    return false;
+#endif
+}
+
+void CompressedSampleCodec::appendHit(std::vector<uint8_t>& body, HitHeader hh,
+                                      const int32_t* codes, size_t n, bool varint)
+{
+    // Reference: rounded mean of the leading (baseline) samples
+    const size_t nref = std::min(n, kReferenceSamples);
+    int64_t sum = 0;
+    for (size_t i = 0; i < nref; ++i)
+        sum += codes[i];
+    const int32_t ref = nref ? static_cast<int32_t>(std::llround(static_cast<double>(sum) / nref)) : 0;
+
+    int32_t zz[256];
+    std::vector<int32_t> zz_heap;
+    int32_t* z = zz;
+    if (n > std::size(zz)) {
+        zz_heap.resize(n);
+        z = zz_heap.data();
+    }
+    for (size_t i = 0; i < n; ++i)
+        z[i] = static_cast<int32_t>(zigzag(static_cast<int32_t>(static_cast<int64_t>(codes[i]) - ref)));
+
+    hh.reference = ref;
+    hh.base.data_size = static_cast<uint16_t>(n);
+    hh.reserved = 0;
+
+    const size_t at = body.size();
+    if (varint) {
+        hh.base.bits = 0;
+        body.resize(at + sizeof(hh) + 5 * n);
+        uint8_t* out = body.data() + at + sizeof(hh);
+        uint8_t* const start = out;
+        for (size_t i = 0; i < n; ++i) {
+            uint32_t v = static_cast<uint32_t>(z[i]);
+            while (v >= 0x80) {
+                *out++ = static_cast<uint8_t>(v | 0x80);
+                v >>= 7;
+            }
+            *out++ = static_cast<uint8_t>(v);
+        }
+        hh.payload_bytes = static_cast<uint16_t>(out - start);
+    } else {
+        // One width byte per block, then each block packed at its own width,
+        // so the baseline blocks are not stored at the width of the pulse
+        const size_t nblocks = (n + kBlock - 1) / kBlock;
+        hh.base.bits = 0;
+        body.resize(at + sizeof(hh) + nblocks + 4 * n);
+        uint8_t* widths = body.data() + at + sizeof(hh);
+        uint8_t* out = widths + nblocks;
+        uint8_t* const start = widths;
+        for (size_t b = 0; b < nblocks; ++b) {
+            const size_t first = b * kBlock;
+            const size_t len = std::min(kBlock, n - first);
+            uint32_t block_all = 0;
+            for (size_t i = first; i < first + len; ++i)
+                block_all |= static_cast<uint32_t>(z[i]);
+            const unsigned bits = static_cast<unsigned>(std::bit_width(block_all));
+            widths[b] = static_cast<uint8_t>(bits);
+            hh.base.bits = std::max<uint8_t>(hh.base.bits, widths[b]);
+            if (bits > 0) {
+                PackedSampleCodec::pack(z + first, len, bits, out);
+                out += PackedSampleCodec::packedBytes(len, bits);
+            }
+        }
+        hh.payload_bytes = static_cast<uint16_t>(out - start);
+    }
+    std::memcpy(body.data() + at, &hh, sizeof(hh));
+    body.resize(at + sizeof(hh) + hh.payload_bytes);
+}
+
+std::vector<uint8_t> CompressedSampleCodec::finish(uint32_t n_hits, const std::vector<uint8_t>& body,
+                                                   bool varint, bool lz4)
+{
+    BankHeader bh{};
+    bh.n_hits          = n_hits;
+    bh.hit_header_size = static_cast<uint16_t>(sizeof(HitHeader));
+    bh.version         = kVersion;
+    bh.flags           = varint ? kVarint : 0;
+    bh.body_size       = static_cast<uint32_t>(body.size());
+
+    std::vector<uint8_t> out;
+#ifdef COMPRESSED_SAMPLE_CODEC_LZ4
+    if (lz4 && !body.empty()) {
+        const int bound = MLZ4_compressBound(static_cast<int>(body.size()));
+        out.resize(sizeof(bh) + static_cast<size_t>(bound));
+        const int n = MLZ4_compress_default(reinterpret_cast<const char*>(body.data()),
+                                            reinterpret_cast<char*>(out.data() + sizeof(bh)),
+                                            static_cast<int>(body.size()), bound);
+        if (n > 0 && static_cast<size_t>(n) < body.size()) {
+            bh.flags |= kLz4;
+            out.resize(sizeof(bh) + static_cast<size_t>(n));
+            std::memcpy(out.data(), &bh, sizeof(bh));
+            return out;
+        }
+    }
+#else
+    (void)lz4;
+#endif
+
+    out.resize(sizeof(bh) + body.size());
+    std::memcpy(out.data(), &bh, sizeof(bh));
+    if (!body.empty())
+        std::memcpy(out.data() + sizeof(bh), body.data(), body.size());
+    return out;
+}
+
+bool CompressedSampleCodec::readBody(const uint8_t* data, size_t size, BankHeader& bh,
+                                     std::vector<uint8_t>& body)
+{
+    if (size < sizeof(bh))
+        return false;
+    std::memcpy(&bh, data, sizeof(bh));
+    if (bh.version != kVersion || bh.hit_header_size < sizeof(HitHeader))
+        return false;
+
+    const uint8_t* src = data + sizeof(bh);
+    const size_t src_size = size - sizeof(bh);
+    body.resize(bh.body_size);
+
+    if (!(bh.flags & kLz4)) {
+        if (src_size < bh.body_size)
+            return false;
+        std::memcpy(body.data(), src, bh.body_size);
+        return true;
+    }
+#ifdef COMPRESSED_SAMPLE_CODEC_LZ4
+    const int n = MLZ4_decompress_safe(reinterpret_cast<const char*>(src),
+                                       reinterpret_cast<char*>(body.data()),
+                                       static_cast<int>(src_size), static_cast<int>(bh.body_size));
+    return n == static_cast<int>(bh.body_size);
+#else
+    return false;
+#endif
+}
+
+bool CompressedSampleCodec::decodeHit(const HitHeader& hh, const uint8_t* payload, size_t n,
+                                      bool varint, int32_t* out)
+{
+    const uint8_t* p = payload;
+    const uint8_t* const end = payload + hh.payload_bytes;
+
+    if (varint) {
+        for (size_t i = 0; i < n; ++i) {
+            uint32_t v = 0;
+            for (unsigned shift = 0;; shift += 7) {
+                if (p == end || shift > 28)
+                    return false;
+                const uint8_t b = *p++;
+                v |= static_cast<uint32_t>(b & 0x7f) << shift;
+                if (!(b & 0x80))
+                    break;
+            }
+            out[i] = static_cast<int32_t>(static_cast<int64_t>(unzigzag(v)) + hh.reference);
+        }
+        return true;
+    }
+
+    const size_t nblocks = (n + kBlock - 1) / kBlock;
+    if (static_cast<size_t>(end - p) < nblocks)
+        return false;
+    const uint8_t* widths = p;
+    p += nblocks;
+    for (size_t b = 0; b < nblocks; ++b) {
+        const size_t first = b * kBlock;
+        const size_t len = std::min(kBlock, n - first);
+        const unsigned bits = widths[b];
+        if (bits == 0) {
+            std::fill_n(out + first, len, 0);
+            continue;
+        }
+        const size_t nbytes = PackedSampleCodec::packedBytes(len, bits);
+        if (bits > 32 || static_cast<size_t>(end - p) < nbytes)
+            return false;
+        PackedSampleCodec::unpack(p, len, bits, out + first);
+        p += nbytes;
+    }
+    for (size_t i = 0; i < n; ++i)
+        out[i] = static_cast<int32_t>(static_cast<int64_t>(unzigzag(static_cast<uint32_t>(out[i]))) + hh.reference);
+    return true;
+}
@@ -0,0 +1,41 @@
+#include "processing/sampic_processing/collector/banks/frontend_event_bank_buffer_stats.h"
+#include <algorithm>
+
+namespace {
+
+uint32_t clampU32(uint64_t v) {
+    return static_cast<uint32_t>(std::min<uint64_t>(v, UINT32_MAX));
+}
+
+FrontendEventBankBufferStats::BufferRecord toRecord(const BufferStats& s) {
+    FrontendEventBankBufferStats::BufferRecord r{};
+    r.pushed          = s.pushed;
+    r.dropped_events  = s.dropped_events;
+    r.dropped_hits    = s.dropped_hits;
+    r.high_water_mark = clampU32(s.high_water_mark);
+    r.occupancy       = clampU32(s.occupancy);
+    r.capacity        = clampU32(s.capacity);
+    return r;
+}
+
+} // namespace
+
+FrontendEventBankBufferStats::FrontendEventBankBufferStats(
+    uint64_t timestamp_ns,
+    const BufferStats& sampic,
+    const BufferStats& frontend,
+    const std::string& prefix)
+{
+    bank_prefix_ = prefix;
+    record_.timestamp_ns = timestamp_ns;
+    record_.sampic       = toRecord(sampic);
+    record_.frontend     = toRecord(frontend);
+}
+
+const uint8_t* FrontendEventBankBufferStats::data() const {
+    return reinterpret_cast<const uint8_t*>(&record_);
+}
+
+size_t FrontendEventBankBufferStats::size() const {
+    return sizeof(Record);
+}
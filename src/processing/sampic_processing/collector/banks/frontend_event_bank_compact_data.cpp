@@ -0,0 +1,64 @@
+#include "processing/sampic_processing/collector/banks/frontend_event_bank_compact_data.h"
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+FrontendEventBankCompactData::FrontendEventBankCompactData(
+    const std::vector<std::shared_ptr<SampicEvent>>& parents,
+    const std::vector<HitRef>& hits,
+    const std::string& prefix)
+{
+    bank_prefix_ = prefix;
+
+    std::vector<const SampicHitTable*> tables(parents.size(), nullptr);
+    size_t spp = 0;
+    for (size_t p = 0; p < parents.size(); ++p) {
+        if (parents[p] && parents[p]->hitTable()) {
+            tables[p] = parents[p]->hitTable().get();
+            spp = std::max(spp, tables[p]->samplesPerHit());
+        }
+    }
+
+    const size_t n = hits.size();
+    const size_t scalar_bytes = n * (2 * sizeof(double) + 3 * sizeof(float) + sizeof(int32_t) +
+                                     4 * sizeof(uint16_t));
+    buffer_.assign(sizeof(Header) + scalar_bytes + n * spp * sizeof(float), 0);
+
+    Header hdr{};
+    hdr.n_hits          = static_cast<uint32_t>(n);
+    hdr.samples_per_hit = static_cast<uint16_t>(spp);
+    hdr.version         = kVersion;
+    std::memcpy(buffer_.data(), &hdr, sizeof(hdr));
+
+    uint8_t* out = buffer_.data() + sizeof(Header);
+
+    // Gather one column at a time: each pass reads one contiguous column per table
+    auto column = [&](auto getter) {
+        using T = typename decltype(getter(std::declval<const SampicHitTable&>()))::value_type;
+        for (const HitRef& h : hits) {
+            const SampicHitTable* t = tables[h.parent];
+            const T v = t ? getter(*t)[h.row] : T{};
+            std::memcpy(out, &v, sizeof(T));
+            out += sizeof(T);
+        }
+    };
+
+    column([](const SampicHitTable& t) { return t.firstCellTimeStamps(); });
+    column([](const SampicHitTable& t) { return t.timeInstants(); });
+    column([](const SampicHitTable& t) { return t.baselines(); });
+    column([](const SampicHitTable& t) { return t.amplitudes(); });
+    column([](const SampicHitTable& t) { return t.peaks(); });
+    column([](const SampicHitTable& t) { return t.hitNumbers(); });
+    column([](const SampicHitTable& t) { return t.boards(); });
+    column([](const SampicHitTable& t) { return t.chips(); });
+    column([](const SampicHitTable& t) { return t.channels(); });
+    column([](const SampicHitTable& t) { return t.dataSizes(); });
+
+    for (const HitRef& h : hits) {
+        if (const SampicHitTable* t = tables[h.parent]) {
+            const auto src = t->samples(h.row);
+            std::memcpy(out, src.data(), src.size() * sizeof(float));
+        }
+        out += spp * sizeof(float);
+    }
+}
@@ -0,0 +1,83 @@
+#include "processing/sampic_processing/collector/banks/frontend_event_bank_compressed_data.h"
+#include "processing/sampic_processing/collector/banks/frontend_event_bank_packed_data.h"
+#include <algorithm>
+#include <cstring>
+
+FrontendEventBankCompressedData::FrontendEventBankCompressedData(const std::string& prefix)
+{
+    bank_prefix_ = prefix;
+}
+
+std::vector<uint8_t> FrontendEventBankCompressedData::encode(
+    const std::vector<const HitStruct*>& hits,
+    unsigned min_bits,
+    const FrontendCompressionConfig& cfg,
+    size_t& packed_size)
+{
+    using Codec = CompressedSampleCodec;
+    const bool varint = cfg.residual_coding == FrontendResidualCoding::VARINT;
+    min_bits = std::clamp(min_bits, 1u, 32u);
+
+    int32_t codes[FrontendEventBankPackedData::kMaxCodes];
+    std::vector<uint8_t> body;
+    body.reserve(hits.size() * (sizeof(Codec::HitHeader) + 64));
+    packed_size = sizeof(PackedSampleCodec::BankHeader);
+
+    uint32_t n_hits = 0;
+    for (const HitStruct* h : hits) {
+        if (!h) continue;
+        const size_t n = FrontendEventBankPackedData::loadCodes(*h, codes);
+
+        Codec::HitHeader hh{};
+        hh.base = FrontendEventBankPackedData::hitHeader(*h, n);
+        Codec::appendHit(body, hh, codes, n, varint);
+
+        const unsigned bits = std::max(min_bits, PackedSampleCodec::requiredBits(codes, n));
+        packed_size += sizeof(PackedSampleCodec::HitHeader) + PackedSampleCodec::packedBytes(n, bits);
+        ++n_hits;
+    }
+
+    return Codec::finish(n_hits, body, varint, cfg.level == FrontendCompressionLevel::DELTA_LZ4);
+}
+
+void FrontendEventBankCompressedData::complete(std::vector<uint8_t>&& payload)
+{
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+        buffer_ = std::move(payload);
+        ready_ = true;
+    }
+    cv_.notify_all();
+}
+
+bool FrontendEventBankCompressedData::ready() const
+{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return ready_;
+}
+
+void FrontendEventBankCompressedData::waitReady() const
+{
+    std::unique_lock<std::mutex> lock(mtx_);
+    cv_.wait(lock, [&] { return ready_; });
+}
+
+const uint8_t* FrontendEventBankCompressedData::data() const
+{
+    waitReady();
+    return buffer_.data();
+}
+
+size_t FrontendEventBankCompressedData::size() const
+{
+    waitReady();
+    return buffer_.size();
+}
+
+size_t FrontendEventBankCompressedData::serializeInto(uint8_t* dst, size_t cap) const
+{
+    waitReady();
+    if (!buffer_.empty() && buffer_.size() <= cap)
+        std::memcpy(dst, buffer_.data(), buffer_.size());
+    return buffer_.size();
+}
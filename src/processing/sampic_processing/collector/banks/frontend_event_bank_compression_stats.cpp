@@ -0,0 +1,30 @@
+#include "processing/sampic_processing/collector/banks/frontend_event_bank_compression_stats.h"
+
+FrontendEventBankCompressionStats::FrontendEventBankCompressionStats(
+    uint64_t timestamp_ns,
+    const FrontendCompressionStats& stats,
+    uint32_t pending,
+    uint32_t workers,
+    const std::string& prefix)
+{
+    bank_prefix_ = prefix;
+    record_.timestamp_ns      = timestamp_ns;
+    record_.banks             = stats.banks;
+    record_.hits              = stats.hits;
+    record_.bytes_in          = stats.bytes_in;
+    record_.bytes_out         = stats.bytes_out;
+    record_.busy_ns           = stats.busy_ns;
+    record_.bypassed          = stats.bypassed;
+    record_.pending           = pending;
+    record_.workers           = workers;
+    record_.ratio             = stats.ratio();
+    record_.mb_per_s_per_core = stats.mbPerSecPerCore();
+}
+
+const uint8_t* FrontendEventBankCompressionStats::data() const {
+    return reinterpret_cast<const uint8_t*>(&record_);
+}
+
+size_t FrontendEventBankCompressionStats::size() const {
+    return sizeof(Record);
+}
@@ -1,5 +1,6 @@
 #include "processing/sampic_processing/collector/banks/frontend_event_bank_data.h"
 #include <cstddef>
+#include <cstring>
 #include <spdlog/spdlog.h>
 
 /**
@@ -10,9 +11,11 @@
  * after CorrectedDataSamples, up to but not including AdvancedParams.
  */
 FrontendEventBankData::FrontendEventBankData(
-    std::vector<std::shared_ptr<SampicEvent>> parents,
-    const std::vector<const HitStruct*>& hits)
-    : parents_(std::move(parents))
+    const std::vector<std::shared_ptr<SampicEvent>>& parents,
+    std::span<const HitStruct* const> hits,
+    std::pmr::memory_resource* mr)
+    : parents_(parents.begin(), parents.end(), mr),
+      slices_(mr)
 {
     bank_prefix_ = "AD";
     slices_.reserve(hits.size() * 2);  ///< header + corrected section
@@ -39,3 +42,14 @@ FrontendEventBankData::FrontendEventBankData(
     spdlog::debug("FrontendEventBankData: built {} hits ({} bytes total, header + corrected only)",
                   hits.size(), total_size_);
 }
+
+size_t FrontendEventBankData::serializeInto(uint8_t* dst, size_t cap) const
+{
+    if (total_size_ > cap)
+        return total_size_;
+    for (const auto& [ptr, len] : slices_) {
+        std::memcpy(dst, ptr, len);
+        dst += len;
+    }
+    return total_size_;
+}
@@ -0,0 +1,47 @@
+#include "processing/sampic_processing/collector/banks/frontend_event_bank_features.h"
+#include <algorithm>
+#include <cstring>
+
+FrontendEventBankFeatures::FrontendEventBankFeatures(
+    const std::vector<std::shared_ptr<SampicEvent>>& parents,
+    const std::vector<HitRef>& hits,
+    const WaveformFeatureExtractor& extractor,
+    const std::string& prefix)
+{
+    bank_prefix_ = prefix;
+
+    const size_t n = hits.size();
+    buffer_.assign(sizeof(Header) + n * sizeof(Record), 0);
+
+    Header hdr{};
+    hdr.n_hits      = static_cast<uint32_t>(n);
+    hdr.record_size = static_cast<uint16_t>(sizeof(Record));
+    hdr.version     = kVersion;
+    std::memcpy(buffer_.data(), &hdr, sizeof(hdr));
+
+    uint8_t* out = buffer_.data() + sizeof(Header);
+    for (const HitRef& h : hits) {
+        Record rec{};
+        const auto& parent = parents[h.parent];
+        if (parent && parent->hitTable()) {
+            const SampicHitTable& t = *parent->hitTable();
+            const auto samples = t.samples(h.row);
+            const size_t ns = std::min<size_t>(t.dataSizes()[h.row], samples.size());
+            const WaveformFeatures f = extractor.extract(samples.data(), ns);
+
+            rec.first_cell_timestamp = t.firstCellTimeStamps()[h.row];
+            rec.hit_number           = t.hitNumbers()[h.row];
+            rec.board                = t.boards()[h.row];
+            rec.channel              = t.channels()[h.row];
+            rec.baseline             = f.baseline;
+            rec.amplitude            = f.amplitude;
+            rec.charge               = f.charge;
+            rec.rise_time_ns         = f.rise_time_ns;
+            rec.cfd_time_ns          = f.cfd_time_ns;
+            rec.peak_index           = f.peak_index;
+            rec.data_size            = static_cast<uint16_t>(ns);
+        }
+        std::memcpy(out, &rec, sizeof(rec));
+        out += sizeof(rec);
+    }
+}
@@ -0,0 +1,26 @@
+#include "processing/sampic_processing/collector/banks/frontend_event_bank_filter_stats.h"
+
+FrontendEventBankFilterStats::FrontendEventBankFilterStats(
+    uint64_t timestamp_ns,
+    const FrontendFilterStats& stats,
+    const std::string& prefix)
+{
+    bank_prefix_ = prefix;
+    record_.timestamp_ns        = timestamp_ns;
+    record_.accepted_groups     = stats.accepted_groups;
+    record_.accepted_hits       = stats.accepted_hits;
+    record_.rejected_groups     = stats.rejected_groups;
+    record_.rejected_hits       = stats.rejected_hits;
+    record_.failed_min_hits     = stats.failed_min_hits;
+    record_.failed_min_channels = stats.failed_min_channels;
+    record_.failed_min_boards   = stats.failed_min_boards;
+    record_.failed_masks        = stats.failed_masks;
+}
+
+const uint8_t* FrontendEventBankFilterStats::data() const {
+    return reinterpret_cast<const uint8_t*>(&record_);
+}
+
+size_t FrontendEventBankFilterStats::size() const {
+    return sizeof(Record);
+}
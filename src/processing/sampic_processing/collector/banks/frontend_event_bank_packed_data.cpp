@@ -0,0 +1,81 @@
+#include "processing/sampic_processing/collector/banks/frontend_event_bank_packed_data.h"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cstring>
+
+size_t FrontendEventBankPackedData::loadCodes(const HitStruct& h, int32_t* codes)
+{
+    // Copied rather than reinterpreted: the vendor sample type may be narrower
+    const size_t n = static_cast<size_t>(std::clamp(h.DataSize, 0, static_cast<int>(kMaxCodes)));
+    std::copy_n(h.OrderedRawDataSamples, n, codes);
+    return n;
+}
+
+PackedSampleCodec::HitHeader FrontendEventBankPackedData::hitHeader(const HitStruct& h, size_t n)
+{
+    PackedSampleCodec::HitHeader hh{};
+    hh.first_cell_timestamp = h.FirstCellTimeStamp;
+    hh.time_instant         = h.TimeInstant;
+    hh.baseline             = static_cast<float>(h.Baseline);
+    hh.peak                 = static_cast<float>(h.Peak);
+    hh.amplitude            = static_cast<float>(h.Amplitude);
+    hh.tot_value            = static_cast<float>(h.TOTValue);
+    hh.hit_number           = static_cast<int32_t>(h.HitNumber);
+    hh.board                = static_cast<uint16_t>(h.FeBoardIndex);
+    hh.chip                 = static_cast<uint8_t>(h.SampicIndex);
+    hh.channel              = static_cast<uint8_t>(h.Channel);
+    hh.data_size            = static_cast<uint16_t>(n);
+    return hh;
+}
+
+FrontendEventBankPackedData::FrontendEventBankPackedData(
+    const std::vector<const HitStruct*>& hits,
+    unsigned min_bits,
+    const std::string& prefix)
+{
+    using Codec = PackedSampleCodec;
+    bank_prefix_ = prefix;
+    min_bits = std::clamp(min_bits, 1u, 32u);
+
+    // Size pass: per-hit width is the configured one unless a code needs more
+    int32_t codes[kMaxCodes];
+    std::vector<uint8_t> bits(hits.size(), 0);
+    size_t total = sizeof(Codec::BankHeader);
+    uint32_t n_hits = 0;
+    for (size_t i = 0; i < hits.size(); ++i) {
+        if (!hits[i]) continue;
+        const size_t n = loadCodes(*hits[i], codes);
+        bits[i] = static_cast<uint8_t>(std::max(min_bits, Codec::requiredBits(codes, n)));
+        total += sizeof(Codec::HitHeader) + Codec::packedBytes(n, bits[i]);
+        ++n_hits;
+    }
+
+    buffer_.resize(total);
+    uint8_t* out = buffer_.data();
+
+    Codec::BankHeader bh{};
+    bh.n_hits          = n_hits;
+    bh.hit_header_size = static_cast<uint16_t>(sizeof(Codec::HitHeader));
+    bh.version         = Codec::kVersion;
+    std::memcpy(out, &bh, sizeof(bh));
+    out += sizeof(bh);
+
+    size_t widened = 0;
+    for (size_t i = 0; i < hits.size(); ++i) {
+        if (!hits[i]) continue;
+        const size_t n = loadCodes(*hits[i], codes);
+
+        Codec::HitHeader hh = hitHeader(*hits[i], n);
+        hh.bits = bits[i];
+        std::memcpy(out, &hh, sizeof(hh));
+        out += sizeof(hh);
+
+        Codec::pack(codes, n, bits[i], out);
+        out += Codec::packedBytes(n, bits[i]);
+        widened += bits[i] > min_bits;
+    }
+
+    if (widened > 0)
+        spdlog::debug("FrontendEventBankPackedData: {} of {} hits needed more than {} bits",
+                      widened, n_hits, min_bits);
+}
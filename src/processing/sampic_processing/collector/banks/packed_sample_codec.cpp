@@ -0,0 +1,151 @@
+#include "processing/sampic_processing/collector/banks/packed_sample_codec.h"
+
+#include <algorithm>
+#include <bit>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define PACKED_SAMPLE_CODEC_X86 1
+#endif
+
+namespace {
+
+constexpr size_t kBlock = 8;  ///< Codes per vector block; always a whole number of bytes
+
+inline uint64_t lowMask(unsigned bits) {
+    return bits >= 64 ? ~0ull : (1ull << bits) - 1;
+}
+
+void packScalar(const int32_t* codes, size_t n, unsigned bits, uint8_t* out) {
+    const uint64_t mask = lowMask(bits);
+    uint64_t acc = 0;
+    unsigned nacc = 0;
+    for (size_t i = 0; i < n; ++i) {
+        acc |= (static_cast<uint32_t>(codes[i]) & mask) << nacc;
+        nacc += bits;
+        while (nacc >= 8) {
+            *out++ = static_cast<uint8_t>(acc);
+            acc >>= 8;
+            nacc -= 8;
+        }
+    }
+    if (nacc > 0)
+        *out = static_cast<uint8_t>(acc);
+}
+
+void unpackScalar(const uint8_t* in, size_t n, unsigned bits, int32_t* out) {
+    const uint64_t mask = lowMask(bits);
+    uint64_t acc = 0;
+    unsigned nacc = 0;
+    for (size_t i = 0; i < n; ++i) {
+        while (nacc < bits) {
+            acc |= static_cast<uint64_t>(*in++) << nacc;
+            nacc += 8;
+        }
+        out[i] = static_cast<int32_t>(static_cast<uint32_t>(acc & mask));
+        acc >>= bits;
+        nacc -= bits;
+    }
+}
+
+#ifdef PACKED_SAMPLE_CODEC_X86
+
+// Eight codes of b <= 16 bits fill exactly b bytes: four codes are shifted
+// into each of two 64-bit words (A, B), which are then joined as A | B << 4b.
+
+__attribute__((target("avx2")))
+void packAvx2(const int32_t* codes, size_t n, unsigned bits, uint8_t* out) {
+    const unsigned half = 4 * bits;
+    const __m256i mask = _mm256_set1_epi32(static_cast<int>(lowMask(bits)));
+    const __m256i shifts = _mm256_setr_epi64x(0, bits, 2 * bits, 3 * bits);
+
+    size_t i = 0;
+    for (; i + kBlock <= n; i += kBlock) {
+        const __m256i v = _mm256_and_si256(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(codes + i)), mask);
+        const __m256i lo = _mm256_sllv_epi64(_mm256_cvtepu32_epi64(_mm256_castsi256_si128(v)), shifts);
+        const __m256i hi = _mm256_sllv_epi64(_mm256_cvtepu32_epi64(_mm256_extracti128_si256(v, 1)), shifts);
+        const __m256i t = _mm256_or_si256(_mm256_unpacklo_epi64(lo, hi), _mm256_unpackhi_epi64(lo, hi));
+        const __m128i ab = _mm_or_si128(_mm256_castsi256_si128(t), _mm256_extracti128_si256(t, 1));
+
+        const uint64_t a = static_cast<uint64_t>(_mm_cvtsi128_si64(ab));
+        const uint64_t b = static_cast<uint64_t>(_mm_extract_epi64(ab, 1));
+        uint64_t w[2];
+        w[0] = half < 64 ? (a | (b << half)) : a;
+        w[1] = half < 64 ? (b >> (64 - half)) : b;
+        std::memcpy(out, w, bits);
+        out += bits;
+    }
+    packScalar(codes + i, n - i, bits, out);
+}
+
+__attribute__((target("avx2")))
+void unpackAvx2(const uint8_t* in, size_t n, unsigned bits, int32_t* out) {
+    const unsigned half = 4 * bits;
+    const __m256i mask = _mm256_set1_epi64x(static_cast<long long>(lowMask(bits)));
+    const __m256i shifts = _mm256_setr_epi64x(0, bits, 2 * bits, 3 * bits);
+    const __m256i even = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+
+    size_t i = 0;
+    for (; i + kBlock <= n; i += kBlock) {
+        uint64_t w[2] = {0, 0};
+        std::memcpy(w, in, bits);
+        in += bits;
+        const uint64_t a = w[0] & lowMask(half);
+        const uint64_t b = half < 64 ? ((w[0] >> half) | (w[1] << (64 - half))) : w[1];
+
+        const __m256i lo = _mm256_and_si256(
+            _mm256_srlv_epi64(_mm256_set1_epi64x(static_cast<long long>(a)), shifts), mask);
+        const __m256i hi = _mm256_and_si256(
+            _mm256_srlv_epi64(_mm256_set1_epi64x(static_cast<long long>(b)), shifts), mask);
+        const __m128i lo32 = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(lo, even));
+        const __m128i hi32 = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(hi, even));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+                            _mm256_inserti128_si256(_mm256_castsi128_si256(lo32), hi32, 1));
+    }
+    unpackScalar(in, n - i, bits, out + i);
+}
+
+bool haveAvx2() {
+    static const bool avx2 = __builtin_cpu_supports("avx2");
+    return avx2;
+}
+
+#endif // PACKED_SAMPLE_CODEC_X86
+
+} // namespace
+
+unsigned PackedSampleCodec::requiredBits(const int32_t* codes, size_t n)
+{
+    uint32_t all = 0;
+    for (size_t i = 0; i < n; ++i)
+        all |= static_cast<uint32_t>(codes[i]);
+    return std::max(1u, static_cast<unsigned>(std::bit_width(all)));
+}
+
+bool PackedSampleCodec::vectorized()
+{
+#ifdef PACKED_SAMPLE_CODEC_X86
+    return haveAvx2();
+#else
+    return false;
+#endif
+}
+
+void PackedSampleCodec::pack(const int32_t* codes, size_t n, unsigned bits, uint8_t* out)
+{
+#ifdef PACKED_SAMPLE_CODEC_X86
+    if (bits <= 16 && haveAvx2())
+        return packAvx2(codes, n, bits, out);
+#endif
+    packScalar(codes, n, bits, out);
+}
+
+void PackedSampleCodec::unpack(const uint8_t* in, size_t n, unsigned bits, int32_t* out)
+{
+#ifdef PACKED_SAMPLE_CODEC_X86
+    if (bits <= 16 && haveAvx2())
+        return unpackAvx2(in, n, bits, out);
+#endif
+    unpackScalar(in, n, bits, out);
+}
@@ -0,0 +1,107 @@
+#include "processing/sampic_processing/collector/frontend_bank_compressor.h"
+#include "processing/sampic_processing/collector/banks/frontend_event_bank_compressed_data.h"
+
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <chrono>
+
+FrontendBankCompressor::FrontendBankCompressor(const FrontendCompressionConfig& cfg, unsigned min_bits)
+    : cfg_(cfg),
+      min_bits_(min_bits)
+{
+    if (cfg_.level == FrontendCompressionLevel::DELTA_LZ4 && !CompressedSampleCodec::lz4Available()) {
+        spdlog::warn("FrontendBankCompressor: built without LZ4, using DELTA compression");
+        cfg_.level = FrontendCompressionLevel::DELTA;
+    }
+
+    const int n = std::max(1, cfg_.num_workers);
+    workers_.reserve(n);
+    for (int i = 0; i < n; ++i)
+        workers_.emplace_back(&FrontendBankCompressor::workerLoop, this);
+
+    spdlog::info("FrontendBankCompressor: level={}, residual_coding={}, workers={}, max_pending_banks={}",
+                 static_cast<int>(cfg_.level), static_cast<int>(cfg_.residual_coding),
+                 n, cfg_.max_pending_banks);
+}
+
+FrontendBankCompressor::~FrontendBankCompressor()
+{
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+    for (auto& t : workers_)
+        t.join();
+
+    const FrontendCompressionStats s = stats();
+    spdlog::info("FrontendBankCompressor: {} banks ({} hits), {:.1f} MB -> {:.1f} MB (ratio {:.2f}), "
+                 "{:.0f} MB/s per core, {} bypassed",
+                 s.banks, s.hits, s.bytes_in / 1e6, s.bytes_out / 1e6, s.ratio(),
+                 s.mbPerSecPerCore(), s.bypassed);
+}
+
+std::shared_ptr<FrontendEventBank>
+FrontendBankCompressor::submit(const std::vector<std::shared_ptr<SampicEvent>>& parents,
+                               std::vector<const HitStruct*> hits)
+{
+    auto bank = std::make_shared<FrontendEventBankCompressedData>();
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+        if (queue_.size() >= cfg_.max_pending_banks) {
+            const uint64_t n = bypassed_.fetch_add(1, std::memory_order_relaxed) + 1;
+            if ((n & (n - 1)) == 0)
+                spdlog::warn("FrontendBankCompressor: queue full, {} bank(s) written uncompressed so far", n);
+            return nullptr;
+        }
+        queue_.push_back(Task{bank, parents, std::move(hits)});
+        pending_.fetch_add(1, std::memory_order_relaxed);
+    }
+    cv_.notify_one();
+    return bank;
+}
+
+void FrontendBankCompressor::workerLoop()
+{
+    for (;;) {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(mtx_);
+            cv_.wait(lock, [&] { return stop_ || !queue_.empty(); });
+            if (queue_.empty())
+                return;  // stop_ and drained
+            task = std::move(queue_.front());
+            queue_.pop_front();
+        }
+
+        const auto t0 = std::chrono::steady_clock::now();
+        size_t packed_size = 0;
+        auto payload = FrontendEventBankCompressedData::encode(task.hits, min_bits_, cfg_, packed_size);
+        const auto busy = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - t0).count();
+
+        banks_.fetch_add(1, std::memory_order_relaxed);
+        hits_.fetch_add(task.hits.size(), std::memory_order_relaxed);
+        bytes_in_.fetch_add(packed_size, std::memory_order_relaxed);
+        bytes_out_.fetch_add(payload.size(), std::memory_order_relaxed);
+        busy_ns_.fetch_add(static_cast<uint64_t>(busy), std::memory_order_relaxed);
+
+        // Release the EventStructs before the readout can pick the bank up
+        task.parents.clear();
+        task.hits.clear();
+        task.bank->complete(std::move(payload));
+        pending_.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+FrontendCompressionStats FrontendBankCompressor::stats() const
+{
+    FrontendCompressionStats s;
+    s.banks     = banks_.load(std::memory_order_relaxed);
+    s.hits      = hits_.load(std::memory_order_relaxed);
+    s.bytes_in  = bytes_in_.load(std::memory_order_relaxed);
+    s.bytes_out = bytes_out_.load(std::memory_order_relaxed);
+    s.busy_ns   = busy_ns_.load(std::memory_order_relaxed);
+    s.bypassed  = bypassed_.load(std::memory_order_relaxed);
+    return s;
+}
@@ -0,0 +1,103 @@
+#include "processing/sampic_processing/collector/frontend_coincidence_filter.h"
+
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <bit>
+
+FrontendCoincidenceFilter::FrontendCoincidenceFilter(const FrontendCoincidenceFilterConfig& cfg)
+    : cfg_(cfg),
+      need_scan_(cfg.min_channels > 1 || cfg.min_boards > 1 || !cfg.required_masks.empty())
+{
+    for (const auto& [name, m] : cfg_.required_masks)
+        masks_.emplace_back(m.board, (uint64_t{m.channels_hi} << 32) | m.channels_lo);
+
+    if (cfg_.enabled)
+        spdlog::info("FrontendCoincidenceFilter enabled (min_hits={}, min_channels={}, min_boards={}, "
+                     "required_masks={})",
+                     cfg_.min_hits, cfg_.min_channels, cfg_.min_boards, cfg_.required_masks.size());
+}
+
+FrontendCoincidenceFilter::~FrontendCoincidenceFilter()
+{
+    if (cfg_.enabled)
+        spdlog::info("FrontendCoincidenceFilter: accepted {} groups ({} hits), rejected {} groups ({} hits): "
+                     "min_hits={}, min_channels={}, min_boards={}, masks={}",
+                     stats_.accepted_groups, stats_.accepted_hits,
+                     stats_.rejected_groups, stats_.rejected_hits,
+                     stats_.failed_min_hits, stats_.failed_min_channels,
+                     stats_.failed_min_boards, stats_.failed_masks);
+}
+
+FrontendCoincidenceFilter::Verdict FrontendCoincidenceFilter::evaluate(const PendingGroup& g)
+{
+    if (g.hits.size() < cfg_.min_hits)
+        return Verdict::MIN_HITS;
+    if (!need_scan_)
+        return Verdict::ACCEPT;
+
+    // Collect the hit channels of the group as one 64-bit mask per board
+    for (uint16_t b : touched_)
+        board_channels_[b] = 0;
+    touched_.clear();
+
+    for (const auto& h : g.hits) {
+        const auto& table = *g.parents[h.parent]->hitTable();
+        const uint16_t board = table.boards()[h.row];
+        const uint16_t channel = table.channels()[h.row];
+
+        if (board >= board_channels_.size())
+            board_channels_.resize(board + 1, 0);
+        if (board_channels_[board] == 0)
+            touched_.push_back(board);
+        board_channels_[board] |= uint64_t{1} << (channel & 63);  // 64 channels per board
+    }
+
+    if (cfg_.min_channels > 1) {
+        uint32_t n = 0;
+        for (uint16_t b : touched_)
+            n += static_cast<uint32_t>(std::popcount(board_channels_[b]));
+        if (n < cfg_.min_channels)
+            return Verdict::MIN_CHANNELS;
+    }
+
+    if (touched_.size() < cfg_.min_boards)
+        return Verdict::MIN_BOARDS;
+
+    for (const auto& [board, channels] : masks_) {
+        if (board >= board_channels_.size() || (board_channels_[board] & channels) == 0)
+            return Verdict::MASKS;
+    }
+    return Verdict::ACCEPT;
+}
+
+void FrontendCoincidenceFilter::apply(std::vector<PendingGroup>& groups)
+{
+    if (!cfg_.enabled)
+        return;
+
+    size_t keep = 0;
+    for (size_t i = 0; i < groups.size(); ++i) {
+        const Verdict v = evaluate(groups[i]);
+        const uint64_t n_hits = groups[i].hits.size();
+
+        if (v == Verdict::ACCEPT) {
+            ++stats_.accepted_groups;
+            stats_.accepted_hits += n_hits;
+            if (keep != i)
+                groups[keep] = std::move(groups[i]);
+            ++keep;
+            continue;
+        }
+
+        ++stats_.rejected_groups;
+        stats_.rejected_hits += n_hits;
+        switch (v) {
+            case Verdict::MIN_HITS:     ++stats_.failed_min_hits; break;
+            case Verdict::MIN_CHANNELS: ++stats_.failed_min_channels; break;
+            case Verdict::MIN_BOARDS:   ++stats_.failed_min_boards; break;
+            case Verdict::MASKS:        ++stats_.failed_masks; break;
+            default: break;
+        }
+    }
+    groups.erase(groups.begin() + static_cast<std::ptrdiff_t>(keep), groups.end());
+}
@@ -8,6 +8,10 @@
 FrontendEvent::FrontendEvent(std::chrono::steady_clock::time_point ts)
     : timestamp_(ts) {}
 
+FrontendEvent::FrontendEvent(std::chrono::steady_clock::time_point ts,
+                             std::pmr::memory_resource* mr)
+    : timestamp_(ts), banks_(mr) {}
+
 FrontendEvent::~FrontendEvent() = default;
 
 // ------------------------------------------------------------------
@@ -22,6 +26,36 @@ std::chrono::steady_clock::time_point FrontendEvent::timestamp() const {
     return timestamp_;
 }
 
+// ------------------------------------------------------------------
+// Hit count
+// ------------------------------------------------------------------
+
+void FrontendEvent::setNumHits(size_t n) {
+    num_hits_ = n;
+}
+
+size_t FrontendEvent::numHits() const {
+    return num_hits_;
+}
+
+void FrontendEvent::setHitSummary(double first_ts, double last_ts, uint64_t board_mask) {
+    first_hit_ts_ = first_ts;
+    last_hit_ts_ = last_ts;
+    board_mask_ = board_mask;
+}
+
+double FrontendEvent::firstHitTimestamp() const {
+    return first_hit_ts_;
+}
+
+double FrontendEvent::lastHitTimestamp() const {
+    return last_hit_ts_;
+}
+
+uint64_t FrontendEvent::boardMask() const {
+    return board_mask_;
+}
+
 // ------------------------------------------------------------------
 // Bank management
 // ------------------------------------------------------------------
@@ -31,11 +65,11 @@ void FrontendEvent::addBank(const std::shared_ptr<FrontendEventBank>& bank) {
         banks_.push_back(bank);
 }
 
-const std::vector<std::shared_ptr<FrontendEventBank>>& FrontendEvent::banks() const {
+const FrontendEvent::BankList& FrontendEvent::banks() const {
     return banks_;
 }
 
-std::vector<std::shared_ptr<FrontendEventBank>>& FrontendEvent::banks() {
+FrontendEvent::BankList& FrontendEvent::banks() {
     return banks_;
 }
 
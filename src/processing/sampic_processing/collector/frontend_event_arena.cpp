@@ -0,0 +1,150 @@
+#include "processing/sampic_processing/collector/frontend_event_arena.h"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+
+namespace {
+
+/// Heap upstream of a block's monotonic buffer; records that the batch spilled.
+class SpillResource final : public std::pmr::memory_resource {
+public:
+    bool used = false;
+
+private:
+    void* do_allocate(size_t bytes, size_t align) override {
+        used = true;
+        return std::pmr::new_delete_resource()->allocate(bytes, align);
+    }
+    void do_deallocate(void* p, size_t bytes, size_t align) override {
+        std::pmr::new_delete_resource()->deallocate(p, bytes, align);
+    }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+} // namespace
+
+/**
+ * One arena block: a monotonic buffer over preallocated storage plus a count
+ * of live allocations. The collector holds one count while the batch is
+ * open, so the block cannot drain before endBatch().
+ */
+class FrontendEventArena::Block final : public std::pmr::memory_resource {
+public:
+    explicit Block(size_t bytes)
+        : storage_(std::make_unique<std::byte[]>(bytes)),  // value-init faults pages in now
+          mono_(storage_.get(), bytes, &spill_) {}
+
+    void open(std::shared_ptr<FrontendEventArena> owner) {
+        owner_ = std::move(owner);
+        live_.store(1, std::memory_order_relaxed);
+    }
+
+    void close() { drop(); }
+
+private:
+    void* do_allocate(size_t bytes, size_t align) override {
+        std::lock_guard<std::mutex> lock(mtx_);
+        live_.fetch_add(1, std::memory_order_relaxed);
+        return mono_.allocate(bytes, align);
+    }
+
+    void do_deallocate(void*, size_t, size_t) override { drop(); }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    void drop() {
+        if (live_.fetch_sub(1, std::memory_order_acq_rel) != 1)
+            return;
+
+        // Last object of a closed batch: release it all at once. The arena
+        // reference is moved out first, since it may be the last one and
+        // destroying the arena destroys this block.
+        std::shared_ptr<FrontendEventArena> owner = std::move(owner_);
+        const bool spilled = spill_.used;
+        mono_.release();
+        spill_.used = false;
+        owner->recycle(this);
+        if (spilled)
+            owner->overflowed_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    std::unique_ptr<std::byte[]> storage_;
+    SpillResource spill_;
+    std::pmr::monotonic_buffer_resource mono_;
+    std::mutex mtx_;  ///< Allocations may come from the sorted mode's workers
+    std::atomic<uint32_t> live_{0};
+    std::shared_ptr<FrontendEventArena> owner_;  ///< Keeps the arena alive while objects are out
+};
+
+FrontendEventArena::FrontendEventArena(size_t num_blocks, size_t block_bytes)
+    : block_bytes_(std::max<size_t>(block_bytes, 4096))
+{
+    blocks_.reserve(num_blocks);
+    free_.reserve(num_blocks);
+    for (size_t i = 0; i < num_blocks; ++i) {
+        blocks_.push_back(std::make_unique<Block>(block_bytes_));
+        free_.push_back(blocks_.back().get());
+    }
+
+    spdlog::debug("FrontendEventArena: preallocated {} blocks of {} KB",
+                  num_blocks, block_bytes_ >> 10);
+}
+
+FrontendEventArena::~FrontendEventArena() = default;
+
+std::pmr::memory_resource* FrontendEventArena::beginBatch() {
+    endBatch();
+
+    Block* block = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+        if (!free_.empty()) {
+            block = free_.back();
+            free_.pop_back();
+            in_use_high_water_ = std::max(in_use_high_water_, blocks_.size() - free_.size());
+        }
+    }
+
+    if (!block) {
+        const uint64_t n = exhausted_.fetch_add(1, std::memory_order_relaxed) + 1;
+        if ((n & (n - 1)) == 0) // log at powers of two to avoid flooding
+            spdlog::warn("FrontendEventArena: all {} blocks in use, {} heap batch(es) so far",
+                         blocks_.size(), n);
+        return std::pmr::get_default_resource();
+    }
+
+    batches_.fetch_add(1, std::memory_order_relaxed);
+    block->open(shared_from_this());
+    current_ = block;
+    return block;
+}
+
+void FrontendEventArena::endBatch() {
+    if (!current_)
+        return;
+    Block* block = current_;
+    current_ = nullptr;
+    block->close();
+}
+
+void FrontendEventArena::recycle(Block* block) {
+    std::lock_guard<std::mutex> lock(mtx_);
+    free_.push_back(block);
+}
+
+FrontendEventArenaStats FrontendEventArena::stats() const {
+    FrontendEventArenaStats s;
+    s.blocks      = blocks_.size();
+    s.block_bytes = block_bytes_;
+    s.batches     = batches_.load(std::memory_order_relaxed);
+    s.exhausted   = exhausted_.load(std::memory_order_relaxed);
+    s.overflowed  = overflowed_.load(std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> lock(mtx_);
+    s.available         = free_.size();
+    s.in_use_high_water = in_use_high_water_;
+    return s;
+}
@@ -1,30 +1,104 @@
 #include "processing/sampic_processing/collector/frontend_event_buffer.h"
 #include <spdlog/spdlog.h>
+#include <algorithm>
+#include <bit>
 
 // ------------------------------------------------------------------
 // Constructor
 // ------------------------------------------------------------------
 
-FrontendEventBuffer::FrontendEventBuffer(size_t capacity)
+FrontendEventBuffer::FrontendEventBuffer(size_t capacity, const BufferOverflowConfig& overflow)
     : capacity_(capacity),
+      overflow_(overflow),
       last_timestamp_(std::chrono::steady_clock::time_point::min()) {}
 
 // ------------------------------------------------------------------
 // Producer interface
 // ------------------------------------------------------------------
 
+uint64_t FrontendEventBuffer::heldFrom() const {
+    if (blocking_consumers_ == 0)
+        return read_seq_;
+    uint64_t seq = last_seq_;
+    for (const auto& c : consumers_) {
+        if (c.active && c.stats.policy == FrontendEventConsumerPolicy::BLOCK)
+            seq = std::min(seq, c.cursor);
+    }
+    return seq;
+}
+
+uint64_t FrontendEventBuffer::readByAll() const {
+    uint64_t seq = blocking_consumers_ == 0 ? read_seq_ : last_seq_;
+    for (const auto& c : consumers_) {
+        if (c.active)
+            seq = std::min(seq, c.cursor);
+    }
+    return seq;
+}
+
+void FrontendEventBuffer::releaseRead() {
+    // Read entries may pin arena blocks and SampicEvents upstream, so they
+    // go now rather than when a push next finds the buffer full
+    const uint64_t seq = readByAll();
+    while (!buffer_.empty() && buffer_.front().seq <= seq)
+        buffer_.pop_front();
+}
+
+uint64_t FrontendEventBuffer::unreadCount() const {
+    if (buffer_.empty())
+        return 0;
+    return last_seq_ - std::max(heldFrom(), buffer_.front().seq - 1);
+}
+
+bool FrontendEventBuffer::makeRoom(std::unique_lock<std::mutex>& lock) {
+    const auto deadline = std::chrono::steady_clock::now() +
+                          std::chrono::milliseconds(overflow_.block_timeout_ms);
+
+    while (!buffer_.empty() && buffer_.size() >= capacity_) {
+        // Entries already handed to the consumers can go without loss
+        if (buffer_.front().seq <= heldFrom()) {
+            buffer_.pop_front();
+            continue;
+        }
+
+        switch (overflow_.policy) {
+            case BufferOverflowPolicy::DROP_OLDEST: {
+                const uint64_t n = counters_.recordDrop(buffer_.front().ev->numHits());
+                if (shouldLogDrop(n))
+                    spdlog::warn("FrontendEventBuffer: full, evicted {} unread event(s) so far", n);
+                buffer_.pop_front();
+                break;
+            }
+            case BufferOverflowPolicy::BLOCK:
+                if (space_cv_.wait_until(lock, deadline, [&] {
+                        return buffer_.size() < capacity_ || buffer_.front().seq <= heldFrom();
+                    }))
+                    break;
+                [[fallthrough]];
+            case BufferOverflowPolicy::DROP_NEWEST:
+            default:
+                return false;
+        }
+    }
+    return true;
+}
+
 void FrontendEventBuffer::push(const std::shared_ptr<FrontendEvent>& ev) {
     if (!ev) return;
 
     std::unique_lock<std::mutex> lock(mtx_);
 
-    if (buffer_.size() >= capacity_) {
-        buffer_.pop_front();
+    if (!makeRoom(lock)) {
+        const uint64_t n = counters_.recordDrop(ev->numHits());
+        if (shouldLogDrop(n))
+            spdlog::warn("FrontendEventBuffer: full, rejected {} new event(s) so far", n);
+        return;
     }
 
     const auto ts = ev->timestamp();
-    buffer_.emplace_back(ev, ts);
+    buffer_.push_back(Entry{ev, ts, ++last_seq_});
     last_timestamp_ = ts;
+    counters_.recordPush(unreadCount());
     cv_.notify_all();
 }
 
@@ -37,8 +111,9 @@ std::optional<std::shared_ptr<FrontendEvent>> FrontendEventBuffer::pop() {
     if (buffer_.empty())
         return std::nullopt;
 
-    auto ev = buffer_.front().first;
+    auto ev = buffer_.front().ev;
     buffer_.pop_front();
+    space_cv_.notify_one();
 
     // Warn if we are discarding an unconsumed event
     if (ev && !ev->consumed()) {
@@ -53,7 +128,7 @@ std::optional<std::shared_ptr<FrontendEvent>> FrontendEventBuffer::latest() {
     std::unique_lock<std::mutex> lock(mtx_);
     if (buffer_.empty())
         return std::nullopt;
-    return buffer_.back().first;
+    return buffer_.back().ev;
 }
 
 std::vector<std::shared_ptr<FrontendEvent>>
@@ -62,13 +137,157 @@ FrontendEventBuffer::getSince(std::chrono::steady_clock::time_point t) {
     std::vector<std::shared_ptr<FrontendEvent>> result;
     result.reserve(buffer_.size());
 
-    for (auto& [ev, ts] : buffer_) {
-        if (ts > t)
-            result.push_back(ev);
+    for (auto& entry : buffer_) {
+        if (entry.ts > t) {
+            result.push_back(entry.ev);
+            read_seq_ = std::max(read_seq_, entry.seq);
+        }
+    }
+    if (!result.empty()) {
+        releaseRead();
+        space_cv_.notify_one();
+    }
+    return result;
+}
+
+std::vector<std::shared_ptr<FrontendEvent>>
+FrontendEventBuffer::getSince(uint64_t& cursor) {
+    std::unique_lock<std::mutex> lock(mtx_);
+    std::vector<std::shared_ptr<FrontendEvent>> result;
+    if (buffer_.empty() || cursor >= last_seq_)
+        return result;
+
+    // Sequence numbers are contiguous in the deque: locate the first unread by offset
+    const uint64_t front_seq = buffer_.front().seq;
+    const size_t start = (cursor >= front_seq) ? static_cast<size_t>(cursor - front_seq + 1) : 0;
+
+    result.reserve(buffer_.size() - start);
+    for (size_t i = start; i < buffer_.size(); ++i)
+        result.push_back(buffer_[i].ev);
+
+    cursor = last_seq_;
+    read_seq_ = std::max(read_seq_, last_seq_);
+    releaseRead();
+    space_cv_.notify_one();
+    return result;
+}
+
+// ------------------------------------------------------------------
+// Registered consumers
+// ------------------------------------------------------------------
+
+FrontendEventBuffer::ConsumerId
+FrontendEventBuffer::addConsumer(const std::string& name, FrontendEventConsumerPolicy policy) {
+    std::unique_lock<std::mutex> lock(mtx_);
+    auto slot = std::find_if(consumers_.begin(), consumers_.end(),
+                             [](const Consumer& c) { return !c.active; });
+    if (slot == consumers_.end())
+        slot = consumers_.emplace(consumers_.end());
+
+    slot->stats = FrontendEventConsumerStats{name, policy};
+    slot->cursor = buffer_.empty() ? last_seq_ : buffer_.front().seq - 1;
+    slot->active = true;
+    if (policy == FrontendEventConsumerPolicy::BLOCK)
+        ++blocking_consumers_;
+
+    spdlog::debug("FrontendEventBuffer: added consumer '{}' ({})", name,
+                  policy == FrontendEventConsumerPolicy::BLOCK ? "BLOCK" : "DROP");
+    return static_cast<ConsumerId>(slot - consumers_.begin());
+}
+
+void FrontendEventBuffer::removeConsumer(ConsumerId id) {
+    std::unique_lock<std::mutex> lock(mtx_);
+    if (id >= consumers_.size() || !consumers_[id].active)
+        return;
+    Consumer& c = consumers_[id];
+    c.active = false;
+    if (c.stats.policy == FrontendEventConsumerPolicy::BLOCK)
+        --blocking_consumers_;
+    releaseRead();
+    space_cv_.notify_all();
+}
+
+std::vector<std::shared_ptr<FrontendEvent>> FrontendEventBuffer::consume(ConsumerId id) {
+    std::unique_lock<std::mutex> lock(mtx_);
+    std::vector<std::shared_ptr<FrontendEvent>> result;
+    if (id >= consumers_.size() || !consumers_[id].active)
+        return result;
+    Consumer& c = consumers_[id];
+
+    // Events evicted (or popped) before this consumer got to them
+    const uint64_t first_stored = buffer_.empty() ? last_seq_ + 1 : buffer_.front().seq;
+    if (c.cursor + 1 < first_stored) {
+        const uint64_t before = c.stats.missed;
+        c.stats.missed += first_stored - 1 - c.cursor;
+        c.cursor = first_stored - 1;
+        // Log when the total passes a power of two, as for drops
+        if (c.stats.policy == FrontendEventConsumerPolicy::DROP &&
+            std::bit_width(before) != std::bit_width(c.stats.missed))
+            spdlog::warn("FrontendEventBuffer: consumer '{}' fell behind, missed {} event(s) so far",
+                         c.stats.name, c.stats.missed);
     }
+    if (c.cursor >= last_seq_)
+        return result;
+
+    const size_t start = static_cast<size_t>(c.cursor + 1 - first_stored);
+    result.reserve(buffer_.size() - start);
+    for (size_t i = start; i < buffer_.size(); ++i)
+        result.push_back(buffer_[i].ev);
+
+    c.stats.read += result.size();
+    c.cursor = last_seq_;
+    releaseRead();
+    if (c.stats.policy == FrontendEventConsumerPolicy::BLOCK)
+        space_cv_.notify_one();
     return result;
 }
 
+uint64_t FrontendEventBuffer::pending(ConsumerId id) const {
+    std::unique_lock<std::mutex> lock(mtx_);
+    if (id >= consumers_.size() || !consumers_[id].active)
+        return 0;
+    return last_seq_ - consumers_[id].cursor;
+}
+
+bool FrontendEventBuffer::waitForConsumer(ConsumerId id, uint64_t count,
+                                          std::chrono::microseconds timeout) {
+    std::unique_lock<std::mutex> lock(mtx_);
+    if (id >= consumers_.size() || !consumers_[id].active)
+        return false;
+    return cv_.wait_for(lock, timeout, [&] {
+        const Consumer& c = consumers_[id];
+        return c.active && last_seq_ >= c.cursor + count;
+    });
+}
+
+FrontendEventConsumerStats FrontendEventBuffer::statsOf(const Consumer& c) const {
+    // Events already evicted count as missed even before consume() notices
+    const uint64_t first_stored = buffer_.empty() ? last_seq_ + 1 : buffer_.front().seq;
+    const uint64_t cursor = std::max(c.cursor, first_stored - 1);
+    FrontendEventConsumerStats s = c.stats;
+    s.missed += cursor - c.cursor;
+    s.pending = last_seq_ - cursor;
+    return s;
+}
+
+FrontendEventConsumerStats FrontendEventBuffer::consumerStats(ConsumerId id) const {
+    std::unique_lock<std::mutex> lock(mtx_);
+    if (id >= consumers_.size() || !consumers_[id].active)
+        return {};
+    return statsOf(consumers_[id]);
+}
+
+std::vector<FrontendEventConsumerStats> FrontendEventBuffer::consumerStats() const {
+    std::unique_lock<std::mutex> lock(mtx_);
+    std::vector<FrontendEventConsumerStats> out;
+    for (const auto& c : consumers_) {
+        if (!c.active)
+            continue;
+        out.push_back(statsOf(c));
+    }
+    return out;
+}
+
 // ------------------------------------------------------------------
 // Polling helpers
 // ------------------------------------------------------------------
@@ -78,12 +297,33 @@ bool FrontendEventBuffer::hasNewSince(std::chrono::steady_clock::time_point t) c
     return last_timestamp_ > t;
 }
 
+bool FrontendEventBuffer::hasNewSince(uint64_t cursor) const {
+    std::unique_lock<std::mutex> lock(mtx_);
+    return last_seq_ > cursor;
+}
+
 bool FrontendEventBuffer::waitForNew(std::chrono::steady_clock::time_point t,
                                      std::chrono::milliseconds timeout) {
     std::unique_lock<std::mutex> lock(mtx_);
     return cv_.wait_for(lock, timeout, [&] { return last_timestamp_ > t; });
 }
 
+bool FrontendEventBuffer::waitForNew(uint64_t cursor, std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(mtx_);
+    return cv_.wait_for(lock, timeout, [&] { return last_seq_ > cursor; });
+}
+
+bool FrontendEventBuffer::waitForCount(uint64_t cursor, uint64_t count,
+                                       std::chrono::microseconds timeout) {
+    std::unique_lock<std::mutex> lock(mtx_);
+    return cv_.wait_for(lock, timeout, [&] { return last_seq_ >= cursor + count; });
+}
+
+uint64_t FrontendEventBuffer::lastSequence() const {
+    std::unique_lock<std::mutex> lock(mtx_);
+    return last_seq_;
+}
+
 size_t FrontendEventBuffer::size() const {
     std::unique_lock<std::mutex> lock(mtx_);
     return buffer_.size();
@@ -93,3 +333,8 @@ bool FrontendEventBuffer::empty() const {
     std::unique_lock<std::mutex> lock(mtx_);
     return buffer_.empty();
 }
+
+BufferStats FrontendEventBuffer::stats() const {
+    std::unique_lock<std::mutex> lock(mtx_);
+    return counters_.snapshot(unreadCount(), capacity_);
+}
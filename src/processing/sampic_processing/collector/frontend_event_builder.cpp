@@ -0,0 +1,185 @@
+#include "processing/sampic_processing/collector/frontend_event_builder.h"
+#include "processing/sampic_processing/collector/banks/frontend_event_bank_data.h"
+#include "processing/sampic_processing/collector/banks/frontend_event_bank_event_timing.h"
+#include "processing/sampic_processing/collector/banks/frontend_event_bank_buffer_stats.h"
+#include "processing/sampic_processing/collector/banks/frontend_event_bank_raw_frames.h"
+#include "processing/sampic_processing/collector/banks/frontend_event_bank_filter_stats.h"
+#include "processing/sampic_processing/collector/banks/frontend_event_bank_features.h"
+#include "processing/sampic_processing/collector/banks/frontend_event_bank_packed_data.h"
+#include "processing/sampic_processing/collector/banks/frontend_event_bank_compression_stats.h"
+
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <limits>
+
+FrontendEventBuilder::FrontendEventBuilder(const FrontendCollectorModeDefaultConfig& cfg)
+    : cfg_(cfg),
+      extractor_(cfg.features),
+      mr_(std::pmr::get_default_resource())
+{
+    if (cfg_.data_bank_format == FrontendDataBankFormat::FEATURES)
+        spdlog::info("FrontendEventBuilder: FEATURES data bank using the {} kernel",
+                     WaveformFeatureExtractor::kernelName(extractor_.kernel()));
+
+    if (cfg_.compression.level != FrontendCompressionLevel::NONE) {
+        if (cfg_.data_bank_format == FrontendDataBankFormat::PACKED)
+            compressor_ = std::make_unique<FrontendBankCompressor>(
+                cfg_.compression, static_cast<unsigned>(cfg_.packed_sample_bits));
+        else
+            spdlog::warn("FrontendEventBuilder: compression applies to PACKED data banks only, ignoring it");
+    }
+
+    if (cfg_.use_event_arena && cfg_.event_arena_blocks > 0) {
+        arena_ = std::make_shared<FrontendEventArena>(
+            cfg_.event_arena_blocks, static_cast<size_t>(cfg_.event_arena_block_kb) << 10);
+    }
+}
+
+FrontendEventBuilder::~FrontendEventBuilder()
+{
+    if (!arena_)
+        return;
+    endCycle();
+    const FrontendEventArenaStats as = arena_->stats();
+    spdlog::info("FrontendEventBuilder event arena: blocks={}x{}KB, batches={}, exhausted={}, "
+                 "overflowed={}, high_water={}",
+                 as.blocks, as.block_bytes >> 10, as.batches, as.exhausted,
+                 as.overflowed, as.in_use_high_water);
+}
+
+void FrontendEventBuilder::beginCycle()
+{
+    if (arena_)
+        mr_ = arena_->beginBatch();
+}
+
+void FrontendEventBuilder::endCycle()
+{
+    if (arena_) {
+        arena_->endBatch();
+        mr_ = std::pmr::get_default_resource();
+    }
+}
+
+std::shared_ptr<FrontendEventBank>
+FrontendEventBuilder::buildDataBank(const PendingGroup& g)
+{
+    if (cfg_.data_bank_format == FrontendDataBankFormat::FEATURES)
+        return allocate<FrontendEventBankFeatures>(g.parents, g.hits, extractor_);
+
+    const bool packed = cfg_.data_bank_format == FrontendDataBankFormat::PACKED;
+    if (cfg_.data_bank_format == FrontendDataBankFormat::HITSTRUCT || packed) {
+        const bool have_structs = std::all_of(g.parents.begin(), g.parents.end(),
+                                              [](const auto& p) { return p && p->data(); });
+        if (have_structs) {
+            auto gather = [&g](auto& hits) {
+                hits.reserve(g.hits.size());
+                for (const HitRef& h : g.hits)
+                    hits.push_back(&g.parents[h.parent]->data()->Hit[h.row]);
+            };
+            if (packed) {
+                std::vector<const HitStruct*> hits;
+                gather(hits);
+                if (compressor_) {
+                    if (auto bank = compressor_->submit(g.parents, hits))
+                        return bank;
+                }
+                return allocate<FrontendEventBankPackedData>(
+                    hits, static_cast<unsigned>(cfg_.packed_sample_bits));
+            }
+            // Zero-copy slices into the parents' EventStructs
+            std::pmr::vector<const HitStruct*> hits(mr_);
+            gather(hits);
+            return allocate<FrontendEventBankData>(g.parents, hits, mr_);
+        }
+
+        if (!warned_no_event_struct_.exchange(true, std::memory_order_relaxed)) {
+            spdlog::warn("FrontendEventBuilder: {} data bank requested but SampicEvents "
+                         "carry no EventStruct (keep_event_struct=false); writing COMPACT banks",
+                         packed ? "PACKED" : "HITSTRUCT");
+        }
+    }
+
+    return allocate<FrontendEventBankCompactData>(g.parents, g.hits);
+}
+
+std::shared_ptr<FrontendEvent>
+FrontendEventBuilder::buildGroupEvent(const PendingGroup& g)
+{
+    auto fev = allocate<FrontendEvent>(g.created, mr_);
+    fev->setNumHits(g.hits.size());
+
+    // Time span and boards, for the file writer's index
+    if (!g.hits.empty()) {
+        double first = std::numeric_limits<double>::infinity();
+        double last = -first;
+        uint64_t boards = 0;
+        for (const HitRef& h : g.hits) {
+            const auto& table = *g.parents[h.parent]->hitTable();
+            const double t = table.firstCellTimeStamps()[h.row];
+            first = std::min(first, t);
+            last = std::max(last, t);
+            boards |= uint64_t{1} << std::min<uint16_t>(table.boards()[h.row], 63);
+        }
+        fev->setHitSummary(first, last, boards);
+    }
+
+    auto data_bank = buildDataBank(g);
+    data_bank->setBankPrefix(cfg_.data_bank_prefix);
+    fev->addBank(data_bank);
+
+    // Optional user-defined postprocessing
+    fev->finalize();
+
+    // Per-event timing bank
+    auto event_timing_bank =
+        allocate<FrontendEventBankEventTiming>(g.created,
+                                               static_cast<uint32_t>(g.hits.size()),
+                                               g.parents);
+    event_timing_bank->setBankPrefix(cfg_.event_timing_bank_prefix);
+    fev->addBank(event_timing_bank);
+
+    return fev;
+}
+
+std::shared_ptr<FrontendEvent>
+FrontendEventBuilder::buildRawEvent(const std::shared_ptr<SampicEvent>& ev)
+{
+    auto fev = allocate<FrontendEvent>(ev->timestamp(), mr_);
+    fev->addBank(allocate<FrontendEventBankRawFrames>(ev->rawFrames(), cfg_.raw_bank_prefix));
+    fev->finalize();
+
+    auto event_timing_bank = allocate<FrontendEventBankEventTiming>(
+        ev->timestamp(), 0u, std::vector<std::shared_ptr<SampicEvent>>{ev});
+    event_timing_bank->setBankPrefix(cfg_.event_timing_bank_prefix);
+    fev->addBank(event_timing_bank);
+
+    return fev;
+}
+
+void FrontendEventBuilder::attachCycleBanks(FrontendEvent& last,
+                                            const FrontendEventBankCollectorTiming::Record& rec,
+                                            const BufferStats& sampic_stats,
+                                            const BufferStats& frontend_stats,
+                                            const FrontendFilterStats* filter_stats)
+{
+    auto collector_bank = allocate<FrontendEventBankCollectorTiming>(rec);
+    collector_bank->setBankPrefix(cfg_.collector_timing_bank_prefix);
+    last.addBank(collector_bank);
+
+    auto stats_bank = allocate<FrontendEventBankBufferStats>(
+        rec.collector_timestamp_ns, sampic_stats, frontend_stats);
+    stats_bank->setBankPrefix(cfg_.buffer_stats_bank_prefix);
+    last.addBank(stats_bank);
+
+    if (filter_stats) {
+        last.addBank(allocate<FrontendEventBankFilterStats>(
+            rec.collector_timestamp_ns, *filter_stats, cfg_.filter_stats_bank_prefix));
+    }
+
+    if (compressor_) {
+        last.addBank(allocate<FrontendEventBankCompressionStats>(
+            rec.collector_timestamp_ns, compressor_->stats(), compressor_->pending(),
+            compressor_->numWorkers(), cfg_.compression_stats_bank_prefix));
+    }
+}
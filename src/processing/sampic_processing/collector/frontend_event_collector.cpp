@@ -1,10 +1,12 @@
 #include "processing/sampic_processing/collector/frontend_event_collector.h"
 #include "processing/sampic_processing/collector/modes/frontend_collector_mode_default.h"
+#include "processing/sampic_processing/collector/modes/frontend_collector_mode_sorted.h"
+#include "processing/sampic_processing/collector/modes/frontend_collector_mode_parallel.h"
 
 FrontendEventCollector::FrontendEventCollector(
     SampicEventBuffer& sampic_buffer,
     const FrontendEventCollectorConfig& cfg)
-    : sampic_buffer_(sampic_buffer),
+    : sampic_buffer_(&sampic_buffer),
       cfg_(cfg)
 {
     buildMode();
@@ -17,12 +19,20 @@ FrontendEventCollector::~FrontendEventCollector() {
 }
 
 void FrontendEventCollector::buildMode() {
-    buffer_ = std::make_unique<FrontendEventBuffer>(cfg_.buffer_size);
+    buffer_ = std::make_shared<FrontendEventBuffer>(cfg_.buffer_size, cfg_.buffer_overflow);
 
     switch (cfg_.mode) {
         case FrontendCollectorModeType::DEFAULT:
             mode_ = std::make_unique<FrontendCollectorModeDefault>(
-                sampic_buffer_, *buffer_, cfg_);
+                *sampic_buffer_, *buffer_, cfg_);
+            break;
+        case FrontendCollectorModeType::SORTED:
+            mode_ = std::make_unique<FrontendCollectorModeSorted>(
+                *sampic_buffer_, *buffer_, cfg_);
+            break;
+        case FrontendCollectorModeType::PARALLEL:
+            mode_ = std::make_unique<FrontendCollectorModeParallel>(
+                *sampic_buffer_, *buffer_, cfg_);
             break;
         default:
             throw std::runtime_error("Unsupported FrontendCollectorModeType");
@@ -33,6 +43,10 @@ void FrontendEventCollector::setConfig(const FrontendEventCollectorConfig& cfg)
     cfg_ = cfg;
 }
 
+void FrontendEventCollector::setSampicBuffer(SampicEventBuffer& sampic_buffer) {
+    sampic_buffer_ = &sampic_buffer;
+}
+
 int FrontendEventCollector::applySettings() {
     const bool was_running = running_;
     if (was_running) stop();
@@ -76,5 +90,7 @@ void FrontendEventCollector::run() {
             std::this_thread::sleep_for(std::chrono::microseconds(cfg_.sleep_time_us));
     }
 
-    spdlog::info("FrontendEventCollector stopped");
+    const BufferStats st = buffer_->stats();
+    spdlog::info("FrontendEventCollector stopped (pushed={}, dropped_events={}, dropped_hits={}, high_water={}/{})",
+                 st.pushed, st.dropped_events, st.dropped_hits, st.high_water_mark, st.capacity);
 }
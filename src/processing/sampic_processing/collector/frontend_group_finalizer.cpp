@@ -0,0 +1,85 @@
+#include "processing/sampic_processing/collector/frontend_group_finalizer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+FrontendGroupFinalizer::FrontendGroupFinalizer(const FrontendCollectorModeDefaultConfig& cfg)
+    : policy_(cfg.finalize_policy),
+      window_ns_(cfg.time_window_ns),
+      margin_ns_(std::max(0.0, cfg.watermark_margin_ns)),
+      finalize_after_(static_cast<int>(cfg.finalize_after_ms)),
+      board_idle_(static_cast<int>(cfg.board_idle_ms)),
+      watermark_ns_(std::numeric_limits<double>::quiet_NaN())
+{
+    // Without new data a group can only become ready through the wall-clock
+    // rule, which for WATERMARK starts once the boards have gone idle
+    const auto idle = (policy_ == FrontendFinalizePolicy::WATERMARK)
+                          ? std::max(board_idle_, finalize_after_)
+                          : finalize_after_;
+    recheck_ = std::max(idle, std::chrono::milliseconds(1));
+
+    if (policy_ == FrontendFinalizePolicy::WATERMARK)
+        boards_.resize(cfg.watermark_boards);
+}
+
+void FrontendGroupFinalizer::observe(const SampicHitTable& table,
+                                     std::chrono::steady_clock::time_point now)
+{
+    if (policy_ != FrontendFinalizePolicy::WATERMARK)
+        return;
+
+    const auto boards = table.boards();
+    const auto ts = table.firstCellTimeStamps();
+    if (ts.empty())
+        return;
+
+    if (!started_) {
+        // Expected boards that have not reported yet hold the watermark at
+        // -inf until they report or go idle
+        for (BoardClock& c : boards_) {
+            c.max_ts_ns = -std::numeric_limits<double>::infinity();
+            c.last_seen = now;
+            c.seen = true;
+        }
+        started_ = true;
+    }
+
+    for (size_t i = 0; i < ts.size(); ++i) {
+        const size_t b = boards[i];
+        if (b >= boards_.size())
+            boards_.resize(b + 1);
+
+        BoardClock& c = boards_[b];
+        if (!c.seen || ts[i] > c.max_ts_ns)
+            c.max_ts_ns = ts[i];
+        c.last_seen = now;
+        c.seen = true;
+    }
+}
+
+void FrontendGroupFinalizer::update(std::chrono::steady_clock::time_point now)
+{
+    cutoff_ = now - finalize_after_;
+    watermark_ns_ = std::numeric_limits<double>::quiet_NaN();
+
+    if (policy_ != FrontendFinalizePolicy::WATERMARK)
+        return;
+
+    const auto active_since = now - board_idle_;
+    for (const BoardClock& c : boards_) {
+        if (!c.seen || c.last_seen < active_since)
+            continue;
+        if (std::isnan(watermark_ns_) || c.max_ts_ns < watermark_ns_)
+            watermark_ns_ = c.max_ts_ns;
+    }
+}
+
+bool FrontendGroupFinalizer::isReady(const FrontendEventBuilder::PendingGroup& g) const
+{
+    if (std::isnan(watermark_ns_))
+        return g.created < cutoff_;
+
+    // A later hit at ts >= watermark can only join if ts - t0 <= window
+    return g.t0_ns + window_ns_ + margin_ns_ < watermark_ns_;
+}
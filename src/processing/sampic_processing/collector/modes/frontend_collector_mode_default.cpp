@@ -1,8 +1,5 @@
 #include "processing/sampic_processing/collector/modes/frontend_collector_mode_default.h"
 #include "processing/sampic_processing/collector/frontend_event.h"
-#include "processing/sampic_processing/collector/banks/frontend_event_bank_data.h"
-#include "processing/sampic_processing/collector/banks/frontend_event_bank_event_timing.h"
-#include "processing/sampic_processing/collector/banks/frontend_event_bank_collector_timing.h"
 
 #include <spdlog/spdlog.h>
 #include <algorithm>
@@ -13,18 +10,22 @@ FrontendCollectorModeDefault::FrontendCollectorModeDefault(
     FrontendEventBuffer& frontend_buffer,
     const FrontendEventCollectorConfig& cfg)
     : FrontendCollectorMode(sampic_buffer, frontend_buffer, cfg),
-      mode_cfg_(cfg.default_mode)
+      mode_cfg_(cfg.default_mode),
+      builder_(cfg.default_mode),
+      finalizer_(cfg.default_mode),
+      filter_(cfg.coincidence_filter)
 {
     time_window_ns_ = mode_cfg_.time_window_ns;
-    finalize_after_ = std::chrono::milliseconds(static_cast<int>(mode_cfg_.finalize_after_ms));
     wait_timeout_   = std::chrono::milliseconds(mode_cfg_.wait_timeout_ms);
 
     ready_groups_.reserve(32);
+    raw_events_.reserve(32);
     emitted_events_.reserve(32);
 
     spdlog::info("FrontendCollectorModeDefault initialized "
-                 "(time_window_ns={}, finalize_after_ms={}, wait_timeout_ms={})",
+                 "(time_window_ns={}, finalize_policy={}, finalize_after_ms={}, wait_timeout_ms={})",
                  time_window_ns_,
+                 static_cast<int>(mode_cfg_.finalize_policy),
                  mode_cfg_.finalize_after_ms,
                  mode_cfg_.wait_timeout_ms);
 }
@@ -39,8 +40,13 @@ bool FrontendCollectorModeDefault::collect()
     // ---------------------------------------------------------------------
     // Step 0: Wait for new SampicEvents
     // ---------------------------------------------------------------------
+    // While groups are pending, wake up in time to finalize them when idle
+    const auto wait_for = pending_groups_.empty()
+                              ? wait_timeout_
+                              : std::min(wait_timeout_, finalizer_.recheckInterval());
     const auto t_wait_start = std::chrono::steady_clock::now();
-    if (!sampic_buffer_.waitForNew(last_timestamp_, wait_timeout_))
+    const bool have_new = sampic_buffer_.waitForNew(sampic_cursor_, wait_for);
+    if (!have_new && pending_groups_.empty())
         return true; // timeout is fine
     const auto t_wait_end = std::chrono::steady_clock::now();
     const auto wait_us =
@@ -49,43 +55,41 @@ bool FrontendCollectorModeDefault::collect()
     // ---------------------------------------------------------------------
     // Step 1: Retrieve new events
     // ---------------------------------------------------------------------
-    auto new_events = sampic_buffer_.getSince(last_timestamp_);
-    if (new_events.empty())
+    std::vector<std::shared_ptr<SampicEvent>> new_events;
+    if (have_new)
+        new_events = sampic_buffer_.getSince(sampic_cursor_);
+    if (new_events.empty() && pending_groups_.empty())
         return true;
 
-    last_timestamp_ = new_events.back()->timestamp();
     const auto now = std::chrono::steady_clock::now();
 
     // ---------------------------------------------------------------------
     // Step 2: Group hits by temporal proximity
     // ---------------------------------------------------------------------
     const auto t_group_start = std::chrono::steady_clock::now();
+    raw_events_.clear();
 
     for (const auto& ev : new_events) {
-        if (!ev || !ev->data())
+        if (ev && ev->rawFrames()) {
+            raw_events_.emplace_back(ev);
             continue;
-        const auto parent = ev->data();
+        }
+        if (!ev || !ev->hitTable())
+            continue;
+        finalizer_.observe(*ev->hitTable(), now);
+        const auto timestamps = ev->hitTable()->firstCellTimeStamps();
 
-        for (int i = 0; i < parent->NbOfHitsInEvent; ++i) {
-            const HitStruct* hit = &parent->Hit[i];
+        for (size_t i = 0; i < timestamps.size(); ++i) {
+            const double ts = timestamps[i];
             bool placed = false;
 
             for (auto& group : pending_groups_) {
-                if (group.hits.empty())
-                    continue;
-
-                const double dt_ns =
-                    std::abs(hit->FirstCellTimeStamp - group.hits.front()->FirstCellTimeStamp);
-                if (dt_ns <= time_window_ns_) {
-                    group.hits.emplace_back(hit);
-
-                    if (std::none_of(group.parents.begin(), group.parents.end(),
-                                     [&](const std::shared_ptr<SampicEvent>& p) {
-                                         return p.get() == ev.get();
-                                     })) {
+                if (std::abs(ts - group.t0_ns) <= time_window_ns_) {
+                    // Events are scanned in order, so ev is either the group's last parent or new to it
+                    if (group.parents.back().get() != ev.get())
                         group.parents.emplace_back(ev);
-                    }
-
+                    group.hits.push_back(HitRef{static_cast<uint32_t>(group.parents.size() - 1),
+                                                static_cast<uint32_t>(i)});
                     placed = true;
                     break;
                 }
@@ -93,11 +97,17 @@ bool FrontendCollectorModeDefault::collect()
 
             if (!placed) {
                 PendingGroup g;
+                if (!spare_groups_.empty()) {
+                    g = std::move(spare_groups_.back());
+                    spare_groups_.pop_back();
+                } else {
+                    g.parents.reserve(16);
+                    g.hits.reserve(256);
+                }
                 g.created = now;
-                g.parents.reserve(16);
-                g.hits.reserve(256);
+                g.t0_ns = ts;
                 g.parents.emplace_back(ev);
-                g.hits.emplace_back(hit);
+                g.hits.push_back(HitRef{0, static_cast<uint32_t>(i)});
                 pending_groups_.emplace_back(std::move(g));
             }
         }
@@ -108,54 +118,59 @@ bool FrontendCollectorModeDefault::collect()
         std::chrono::duration_cast<std::chrono::microseconds>(t_group_end - t_group_start);
 
     // ---------------------------------------------------------------------
-    // Step 3: Finalize aged groups
+    // Step 3: Finalize complete groups, keeping creation order
     // ---------------------------------------------------------------------
-    const auto cutoff = now - finalize_after_;
+    finalizer_.update(now);
     ready_groups_.clear();
 
-    while (!pending_groups_.empty() && pending_groups_.front().created < cutoff) {
-        ready_groups_.emplace_back(std::move(pending_groups_.front()));
-        pending_groups_.pop_front();
+    size_t keep = 0;
+    for (size_t i = 0; i < pending_groups_.size(); ++i) {
+        if (finalizer_.isReady(pending_groups_[i])) {
+            ready_groups_.emplace_back(std::move(pending_groups_[i]));
+        } else {
+            if (keep != i)
+                pending_groups_[keep] = std::move(pending_groups_[i]);
+            ++keep;
+        }
     }
+    pending_groups_.erase(pending_groups_.begin() + static_cast<std::ptrdiff_t>(keep),
+                          pending_groups_.end());
 
-    if (ready_groups_.empty())
+    // Drop groups that fail the coincidence conditions before any bank is built
+    filter_.apply(ready_groups_);
+
+    if (ready_groups_.empty() && raw_events_.empty())
         return true;
 
     // ---------------------------------------------------------------------
     // Step 4: Emit finalized FrontendEvents
     // ---------------------------------------------------------------------
     emitted_events_.clear();
-    emitted_events_.reserve(ready_groups_.size());
+    emitted_events_.reserve(ready_groups_.size() + raw_events_.size());
+    builder_.beginCycle();
 
     uint32_t total_hits = 0;
     const auto t_finalize_start = std::chrono::steady_clock::now();
 
+    // Undecoded readouts: one FrontendEvent each, frames passed through as-is
+    for (const auto& ev : raw_events_)
+        emitted_events_.emplace_back(builder_.buildRawEvent(ev));
+
     for (auto& g : ready_groups_) {
         if (g.hits.empty())
             continue;
         total_hits += static_cast<uint32_t>(g.hits.size());
 
-        auto fev = std::make_shared<FrontendEvent>(g.created);
-
-        // Zero-copy data bank (no temporary vector)
-        auto data_bank = std::make_shared<FrontendEventBankData>(g.parents, g.hits);
-        data_bank->setBankPrefix(mode_cfg_.data_bank_prefix);
-        fev->addBank(data_bank);
-
-        // Optional user-defined postprocessing
-        fev->finalize();
-
-        // Per-event timing bank
-        auto event_timing_bank =
-            std::make_shared<FrontendEventBankEventTiming>(g.created,
-                                                           static_cast<uint32_t>(g.hits.size()),
-                                                           g.parents);
-        event_timing_bank->setBankPrefix(mode_cfg_.event_timing_bank_prefix);
-        fev->addBank(event_timing_bank);
+        emitted_events_.emplace_back(builder_.buildGroupEvent(g));
+    }
 
-        frontend_buffer_.push(fev);
-        emitted_events_.emplace_back(std::move(fev));
+    // Keep the built groups' vectors for the next ones
+    for (auto& g : ready_groups_) {
+        g.parents.clear();
+        g.hits.clear();
+        spare_groups_.emplace_back(std::move(g));
     }
+    ready_groups_.clear();
 
     const auto t_finalize_end = std::chrono::steady_clock::now();
     const auto finalize_us =
@@ -164,7 +179,7 @@ bool FrontendCollectorModeDefault::collect()
         std::chrono::duration_cast<std::chrono::microseconds>(t_finalize_end - t_start);
 
     // ---------------------------------------------------------------------
-    // Step 5: Collector timing bank (last event only)
+    // Step 5: Collector timing + buffer stats banks (last event only)
     // ---------------------------------------------------------------------
     if (!emitted_events_.empty()) {
         FrontendEventBankCollectorTiming::Record rec{};
@@ -178,10 +193,17 @@ bool FrontendCollectorModeDefault::collect()
         rec.finalize_us    = static_cast<uint32_t>(finalize_us.count());
         rec.total_us       = static_cast<uint32_t>(total_us.count());
 
-        auto collector_bank = std::make_shared<FrontendEventBankCollectorTiming>(rec);
-        collector_bank->setBankPrefix(mode_cfg_.collector_timing_bank_prefix);
-        emitted_events_.back()->addBank(collector_bank);
+        builder_.attachCycleBanks(*emitted_events_.back(), rec,
+                                  sampic_buffer_.stats(), frontend_buffer_.stats(),
+                                  filter_.enabled() ? &filter_.stats() : nullptr);
     }
+    builder_.endCycle();
+
+    // ---------------------------------------------------------------------
+    // Step 6: Publish (only once all banks are attached)
+    // ---------------------------------------------------------------------
+    for (const auto& fev : emitted_events_)
+        frontend_buffer_.push(fev);
 
     spdlog::debug("FrontendCollectorModeDefault: emitted {} FrontendEvents ({} total hits, {} µs total)",
                   emitted_events_.size(), total_hits, total_us.count());
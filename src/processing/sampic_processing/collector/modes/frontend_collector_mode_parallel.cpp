@@ -0,0 +1,186 @@
+#include "processing/sampic_processing/collector/modes/frontend_collector_mode_parallel.h"
+
+#include <spdlog/spdlog.h>
+#include <algorithm>
+
+FrontendCollectorModeParallel::FrontendCollectorModeParallel(
+    SampicEventBuffer& sampic_buffer,
+    FrontendEventBuffer& frontend_buffer,
+    const FrontendEventCollectorConfig& cfg)
+    : FrontendCollectorModeSorted(sampic_buffer, frontend_buffer, cfg),
+      parallel_cfg_(cfg.parallel_mode)
+{
+    const int n_workers = std::max(0, parallel_cfg_.num_workers);
+    workers_.reserve(n_workers);
+    for (int i = 0; i < n_workers; ++i)
+        workers_.emplace_back(&FrontendCollectorModeParallel::workerLoop, this);
+
+    spdlog::info("FrontendCollectorModeParallel initialized (num_workers={}, min_hits_per_slice={})",
+                 n_workers, parallel_cfg_.min_hits_per_slice);
+}
+
+FrontendCollectorModeParallel::~FrontendCollectorModeParallel()
+{
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+        stopping_ = true;
+    }
+    work_cv_.notify_all();
+    for (auto& t : workers_) {
+        if (t.joinable())
+            t.join();
+    }
+}
+
+// ------------------------------------------------------------------
+// Worker pool
+// ------------------------------------------------------------------
+
+void FrontendCollectorModeParallel::runTasks()
+{
+    for (size_t i = next_task_.fetch_add(1, std::memory_order_relaxed); i < job_size_;
+         i = next_task_.fetch_add(1, std::memory_order_relaxed))
+        (*job_)(i);
+}
+
+void FrontendCollectorModeParallel::workerLoop()
+{
+    uint64_t seen = 0;
+    std::unique_lock<std::mutex> lock(mtx_);
+    for (;;) {
+        work_cv_.wait(lock, [&] { return stopping_ || generation_ != seen; });
+        if (stopping_)
+            return;
+        seen = generation_;
+
+        lock.unlock();
+        runTasks();
+        lock.lock();
+
+        if (--busy_workers_ == 0)
+            done_cv_.notify_one();
+    }
+}
+
+void FrontendCollectorModeParallel::parallelFor(size_t n, const std::function<void(size_t)>& fn)
+{
+    if (n <= 1 || workers_.empty()) {
+        FrontendCollectorModeSorted::parallelFor(n, fn);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+        job_ = &fn;
+        job_size_ = n;
+        next_task_.store(0, std::memory_order_relaxed);
+        busy_workers_ = workers_.size();
+        ++generation_;
+    }
+    work_cv_.notify_all();
+
+    runTasks();
+
+    std::unique_lock<std::mutex> lock(mtx_);
+    done_cv_.wait(lock, [&] { return busy_workers_ == 0; });
+    job_ = nullptr;
+}
+
+// ------------------------------------------------------------------
+// Time-slice group assignment
+// ------------------------------------------------------------------
+
+FrontendCollectorModeParallel::HitIter
+FrontendCollectorModeParallel::nextCut(HitIter p, HitIter first, HitIter last) const
+{
+    // Same comparison as the sweep: a group at the previous hit's time cannot take p
+    while (p != first && p != last && !(std::prev(p)->ts < p->ts - time_window_ns_))
+        ++p;
+    return p;
+}
+
+void FrontendCollectorModeParallel::assignHits(const std::vector<std::shared_ptr<SampicEvent>>& events,
+                                               std::chrono::steady_clock::time_point now,
+                                               HitIter first, HitIter last)
+{
+    const size_t min_slice = std::max<size_t>(1, parallel_cfg_.min_hits_per_slice);
+    if (workers_.empty() || static_cast<size_t>(last - first) < 2 * min_slice) {
+        FrontendCollectorModeSorted::assignHits(events, now, first, last);
+        return;
+    }
+
+    // ---------------------------------------------------------------------
+    // Head: hits that may still join a group from an earlier cycle, swept serially
+    // ---------------------------------------------------------------------
+    HitIter head_end = first;
+    if (!open_groups_.empty()) {
+        const double max_t0 = open_groups_.back().g.t0_ns;
+        head_end = std::partition_point(first, last, [&](const MergedHit& h) {
+            return !(max_t0 < h.ts - time_window_ns_);
+        });
+        head_end = nextCut(head_end, first, last);
+    }
+    FrontendCollectorModeSorted::assignHits(events, now, first, head_end);
+
+    // ---------------------------------------------------------------------
+    // Cut the rest into slices at gaps longer than the window
+    // ---------------------------------------------------------------------
+    const size_t target = std::max(min_slice, static_cast<size_t>(last - head_end) / (workers_.size() + 1));
+    n_slices_ = 0;
+    for (HitIter s = head_end; s != last;) {
+        const HitIter e = (static_cast<size_t>(last - s) > target) ? nextCut(s + target, s, last) : last;
+        if (n_slices_ == slices_.size())
+            slices_.emplace_back();
+        Slice& slice = slices_[n_slices_++];
+        slice.first = s;
+        slice.last = e;
+        s = e;
+    }
+
+    // ---------------------------------------------------------------------
+    // Sweep each slice on its own; only the slice's latest group can match
+    // ---------------------------------------------------------------------
+    parallelFor(n_slices_, [&](size_t i) {
+        Slice& slice = slices_[i];
+        slice.groups.clear();
+        slice.markers.assign(events.size(), ParentMarker{});
+
+        for (auto hit = slice.first; hit != slice.last; ++hit) {
+            const MergedHit& h = *hit;
+            if (slice.groups.empty() || slice.groups.back().t0_ns < h.ts - time_window_ns_) {
+                PendingGroup& g = slice.groups.emplace_back();
+                g.created = now;
+                g.t0_ns = h.ts;
+                g.parents.reserve(16);
+                g.hits.reserve(256);
+            }
+
+            const uint64_t local_id = slice.groups.size() - 1;
+            PendingGroup& g = slice.groups.back();
+            ParentMarker& m = slice.markers[h.event];
+            if (m.group_id != local_id) {
+                g.parents.emplace_back(events[h.event]);
+                m.group_id = local_id;
+                m.parent = static_cast<uint32_t>(g.parents.size() - 1);
+            }
+            g.hits.push_back(HitRef{m.parent, h.row});
+        }
+    });
+
+    // ---------------------------------------------------------------------
+    // Append in time order, translating slice-local ids
+    // ---------------------------------------------------------------------
+    for (size_t i = 0; i < n_slices_; ++i) {
+        Slice& slice = slices_[i];
+        const uint64_t base = next_group_id_;
+
+        for (size_t e = 0; e < slice.markers.size(); ++e) {
+            const ParentMarker& m = slice.markers[e];
+            if (m.group_id != UINT64_MAX)
+                markers_[e] = ParentMarker{base + m.group_id, m.parent};
+        }
+        for (auto& g : slice.groups)
+            open_groups_.push_back(OpenGroup{next_group_id_++, std::move(g)});
+        slice.groups.clear();
+    }
+}
@@ -0,0 +1,306 @@
+#include "processing/sampic_processing/collector/modes/frontend_collector_mode_sorted.h"
+
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+FrontendCollectorModeSorted::FrontendCollectorModeSorted(
+    SampicEventBuffer& sampic_buffer,
+    FrontendEventBuffer& frontend_buffer,
+    const FrontendEventCollectorConfig& cfg)
+    : FrontendCollectorMode(sampic_buffer, frontend_buffer, cfg),
+      mode_cfg_(cfg.default_mode),
+      sorted_cfg_(cfg.sorted_mode),
+      builder_(cfg.default_mode),
+      finalizer_(cfg.default_mode),
+      filter_(cfg.coincidence_filter)
+{
+    time_window_ns_ = mode_cfg_.time_window_ns;
+    wait_timeout_   = std::chrono::milliseconds(mode_cfg_.wait_timeout_ms);
+
+    ready_groups_.reserve(32);
+    decoded_events_.reserve(32);
+    raw_events_.reserve(32);
+    emitted_events_.reserve(32);
+    merged_.reserve(4096);
+
+    spdlog::info("FrontendCollectorModeSorted initialized "
+                 "(time_window_ns={}, finalize_policy={}, finalize_after_ms={}, wait_timeout_ms={}, sort_within_event={})",
+                 time_window_ns_,
+                 static_cast<int>(mode_cfg_.finalize_policy),
+                 mode_cfg_.finalize_after_ms,
+                 mode_cfg_.wait_timeout_ms,
+                 sorted_cfg_.sort_within_event);
+}
+
+void FrontendCollectorModeSorted::mergeHits(const std::vector<std::shared_ptr<SampicEvent>>& events)
+{
+    auto by_time = [](const MergedHit& a, const MergedHit& b) { return a.ts < b.ts; };
+
+    // Held hits form the first run; they precede new hits with equal timestamps
+    merged_.assign(held_hits_.begin(), held_hits_.end());
+    bounds_.clear();
+    bounds_.push_back(0);
+    if (!merged_.empty())
+        bounds_.push_back(merged_.size());
+
+    // Append the per-event runs, then sort each by timestamp (stable, so ties keep row order)
+    const size_t first_new = bounds_.size() - 1;
+    for (size_t e = held_events_.size(); e < events.size(); ++e) {
+        const auto ts = events[e]->hitTable()->firstCellTimeStamps();
+        for (size_t r = 0; r < ts.size(); ++r)
+            merged_.push_back(MergedHit{ts[r], static_cast<uint32_t>(e), static_cast<uint32_t>(r)});
+        bounds_.push_back(merged_.size());
+    }
+
+    if (sorted_cfg_.sort_within_event) {
+        parallelFor(bounds_.size() - 1 - first_new, [&](size_t i) {
+            const auto first = merged_.begin() + static_cast<std::ptrdiff_t>(bounds_[first_new + i]);
+            const auto last  = merged_.begin() + static_cast<std::ptrdiff_t>(bounds_[first_new + i + 1]);
+            if (!std::is_sorted(first, last, by_time))
+                std::stable_sort(first, last, by_time);
+        });
+    }
+
+    // k-way merge as a tree of stable 2-way merges: log2(k) passes, the
+    // merges within a pass being independent. Earlier runs win ties, so
+    // equal timestamps keep arrival order.
+    while (bounds_.size() > 2) {
+        scratch_.resize(merged_.size());
+        next_bounds_.clear();
+        next_bounds_.push_back(0);
+        for (size_t i = 0; i + 1 < bounds_.size(); i += 2)
+            next_bounds_.push_back(bounds_[std::min(i + 2, bounds_.size() - 1)]);
+
+        parallelFor(next_bounds_.size() - 1, [&](size_t pair) {
+            const size_t i = 2 * pair;
+            const auto first = merged_.begin() + static_cast<std::ptrdiff_t>(bounds_[i]);
+            const auto mid   = merged_.begin() + static_cast<std::ptrdiff_t>(bounds_[i + 1]);
+            const auto out   = scratch_.begin() + static_cast<std::ptrdiff_t>(bounds_[i]);
+            if (i + 2 < bounds_.size()) {
+                const auto last = merged_.begin() + static_cast<std::ptrdiff_t>(bounds_[i + 2]);
+                std::merge(first, mid, mid, last, out, by_time);
+            } else {
+                std::copy(first, mid, out);
+            }
+        });
+        merged_.swap(scratch_);
+        bounds_.swap(next_bounds_);
+    }
+}
+
+void FrontendCollectorModeSorted::parallelFor(size_t n, const std::function<void(size_t)>& fn)
+{
+    for (size_t i = 0; i < n; ++i)
+        fn(i);
+}
+
+void FrontendCollectorModeSorted::assignHits(const std::vector<std::shared_ptr<SampicEvent>>& events,
+                                             std::chrono::steady_clock::time_point now,
+                                             HitIter first, HitIter last)
+{
+    for (auto hit = first; hit != last; ++hit) {
+        const MergedHit& h = *hit;
+        // Earliest open group with t0 >= ts - window; it matches if t0 <= ts + window
+        auto it = std::lower_bound(open_groups_.begin(), open_groups_.end(), h.ts - time_window_ns_,
+                                   [](const OpenGroup& og, double v) { return og.g.t0_ns < v; });
+
+        if (it == open_groups_.end() || it->g.t0_ns > h.ts + time_window_ns_) {
+            // Everything before it ends before ts - window and it starts after ts + window
+            it = open_groups_.insert(it, OpenGroup{next_group_id_++, PendingGroup{}});
+            it->g.created = now;
+            it->g.t0_ns = h.ts;
+            it->g.parents.reserve(16);
+            it->g.hits.reserve(256);
+        }
+
+        ParentMarker& m = markers_[h.event];
+        if (m.group_id != it->id) {
+            it->g.parents.emplace_back(events[h.event]);
+            m.group_id = it->id;
+            m.parent = static_cast<uint32_t>(it->g.parents.size() - 1);
+        }
+        it->g.hits.push_back(HitRef{m.parent, h.row});
+    }
+}
+
+void FrontendCollectorModeSorted::sweep(const std::vector<std::shared_ptr<SampicEvent>>& events,
+                                        std::chrono::steady_clock::time_point now,
+                                        double limit_ns)
+{
+    markers_.assign(held_markers_.begin(), held_markers_.end());
+    markers_.resize(events.size(), ParentMarker{});
+
+    const auto split = std::lower_bound(merged_.begin(), merged_.end(), limit_ns,
+                                        [](const MergedHit& h, double v) { return h.ts < v; });
+
+    assignHits(events, now, merged_.begin(), split);
+
+    // Keep the rest, renumbering their events densely
+    remap_.assign(events.size(), UINT32_MAX);
+    held_hits_.clear();
+    held_events_.clear();
+    held_markers_.clear();
+    for (auto hit = split; hit != merged_.end(); ++hit) {
+        uint32_t& idx = remap_[hit->event];
+        if (idx == UINT32_MAX) {
+            idx = static_cast<uint32_t>(held_events_.size());
+            held_events_.emplace_back(events[hit->event]);
+            held_markers_.emplace_back(markers_[hit->event]);
+        }
+        held_hits_.push_back(MergedHit{hit->ts, idx, hit->row});
+    }
+}
+
+bool FrontendCollectorModeSorted::collect()
+{
+    const auto t_start = std::chrono::steady_clock::now();
+
+    // ---------------------------------------------------------------------
+    // Step 0: Wait for new SampicEvents
+    // ---------------------------------------------------------------------
+    // While groups or held hits are pending, wake up in time to finalize them when idle
+    const bool pending = !open_groups_.empty() || !held_hits_.empty();
+    const auto wait_for = !pending
+                              ? wait_timeout_
+                              : std::min(wait_timeout_, finalizer_.recheckInterval());
+    const auto t_wait_start = std::chrono::steady_clock::now();
+    const bool have_new = sampic_buffer_.waitForNew(sampic_cursor_, wait_for);
+    if (!have_new && !pending)
+        return true; // timeout is fine
+    const auto t_wait_end = std::chrono::steady_clock::now();
+    const auto wait_us =
+        std::chrono::duration_cast<std::chrono::microseconds>(t_wait_end - t_wait_start);
+
+    // ---------------------------------------------------------------------
+    // Step 1: Retrieve new events
+    // ---------------------------------------------------------------------
+    std::vector<std::shared_ptr<SampicEvent>> new_events;
+    if (have_new)
+        new_events = sampic_buffer_.getSince(sampic_cursor_);
+    if (new_events.empty() && !pending)
+        return true;
+
+    const auto now = std::chrono::steady_clock::now();
+
+    // Events with held-back hits come first, matching held_hits_' indexes
+    decoded_events_.assign(held_events_.begin(), held_events_.end());
+    raw_events_.clear();
+    for (auto& ev : new_events) {
+        if (!ev)
+            continue;
+        if (ev->rawFrames()) {
+            raw_events_.emplace_back(std::move(ev));
+        } else if (ev->hitTable() && ev->hitTable()->size() > 0) {
+            finalizer_.observe(*ev->hitTable(), now);
+            decoded_events_.emplace_back(std::move(ev));
+        }
+    }
+
+    // ---------------------------------------------------------------------
+    // Step 2: Merge hits by timestamp and sweep them into groups
+    // ---------------------------------------------------------------------
+    const auto t_group_start = std::chrono::steady_clock::now();
+
+    // Hits a slower board could still precede wait for the watermark to pass
+    finalizer_.update(now);
+    const double wm = finalizer_.watermark();
+    const double limit_ns = std::isnan(wm) ? std::numeric_limits<double>::infinity()
+                                           : wm - mode_cfg_.watermark_margin_ns;
+
+    if (!decoded_events_.empty()) {
+        mergeHits(decoded_events_);
+        sweep(decoded_events_, now, limit_ns);
+    }
+
+    const auto t_group_end = std::chrono::steady_clock::now();
+    const auto group_build_us =
+        std::chrono::duration_cast<std::chrono::microseconds>(t_group_end - t_group_start);
+
+    // ---------------------------------------------------------------------
+    // Step 3: Finalize complete groups, keeping t0 order
+    // ---------------------------------------------------------------------
+    ready_groups_.clear();
+
+    size_t keep = 0;
+    for (size_t i = 0; i < open_groups_.size(); ++i) {
+        if (finalizer_.isReady(open_groups_[i].g)) {
+            ready_groups_.emplace_back(std::move(open_groups_[i].g));
+        } else {
+            if (keep != i)
+                open_groups_[keep] = std::move(open_groups_[i]);
+            ++keep;
+        }
+    }
+    open_groups_.erase(open_groups_.begin() + static_cast<std::ptrdiff_t>(keep), open_groups_.end());
+
+    // Drop groups that fail the coincidence conditions before any bank is built
+    filter_.apply(ready_groups_);
+
+    if (ready_groups_.empty() && raw_events_.empty())
+        return true;
+
+    // ---------------------------------------------------------------------
+    // Step 4: Emit finalized FrontendEvents
+    // ---------------------------------------------------------------------
+    emitted_events_.clear();
+    emitted_events_.reserve(ready_groups_.size() + raw_events_.size());
+    builder_.beginCycle();
+
+    uint32_t total_hits = 0;
+    const auto t_finalize_start = std::chrono::steady_clock::now();
+
+    for (const auto& ev : raw_events_)
+        emitted_events_.emplace_back(builder_.buildRawEvent(ev));
+
+    // Groups always hold at least one hit; each is built into its own slot
+    const size_t first_group = emitted_events_.size();
+    emitted_events_.resize(first_group + ready_groups_.size());
+    for (const auto& g : ready_groups_)
+        total_hits += static_cast<uint32_t>(g.hits.size());
+
+    parallelFor(ready_groups_.size(), [&](size_t i) {
+        emitted_events_[first_group + i] = builder_.buildGroupEvent(ready_groups_[i]);
+    });
+
+    const auto t_finalize_end = std::chrono::steady_clock::now();
+    const auto finalize_us =
+        std::chrono::duration_cast<std::chrono::microseconds>(t_finalize_end - t_finalize_start);
+    const auto total_us =
+        std::chrono::duration_cast<std::chrono::microseconds>(t_finalize_end - t_start);
+
+    // ---------------------------------------------------------------------
+    // Step 5: Collector timing + buffer stats banks (last event only)
+    // ---------------------------------------------------------------------
+    if (!emitted_events_.empty()) {
+        FrontendEventBankCollectorTiming::Record rec{};
+        rec.collector_timestamp_ns = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                t_start.time_since_epoch()).count());
+        rec.n_events       = static_cast<uint32_t>(emitted_events_.size());
+        rec.total_hits     = total_hits;
+        rec.wait_us        = static_cast<uint32_t>(wait_us.count());
+        rec.group_build_us = static_cast<uint32_t>(group_build_us.count());
+        rec.finalize_us    = static_cast<uint32_t>(finalize_us.count());
+        rec.total_us       = static_cast<uint32_t>(total_us.count());
+
+        builder_.attachCycleBanks(*emitted_events_.back(), rec,
+                                  sampic_buffer_.stats(), frontend_buffer_.stats(),
+                                  filter_.enabled() ? &filter_.stats() : nullptr);
+    }
+    builder_.endCycle();
+
+    // ---------------------------------------------------------------------
+    // Step 6: Publish (only once all banks are attached)
+    // ---------------------------------------------------------------------
+    for (const auto& fev : emitted_events_)
+        frontend_buffer_.push(fev);
+
+    spdlog::debug("FrontendCollectorModeSorted: emitted {} FrontendEvents ({} total hits, {} open groups, {} µs total)",
+                  emitted_events_.size(), total_hits, open_groups_.size(), total_us.count());
+    spdlog::trace("FrontendCollectorModeSorted timing: wait={}us, group={}us, finalize={}us, total={}us",
+                  wait_us.count(), group_build_us.count(), finalize_us.count(), total_us.count());
+
+    return true;
+}
@@ -0,0 +1,245 @@
+#include "processing/sampic_processing/collector/waveform_feature_extractor.h"
+
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define WAVEFORM_FEATURES_X86 1
+#endif
+
+namespace {
+constexpr size_t kLanes = 8;
+} // namespace
+
+struct WaveformFeatureExtractor::Reduction {
+    float sum[kLanes];
+    float min_v[kLanes];
+    float max_v[kLanes];
+    int32_t min_i[kLanes];
+    int32_t max_i[kLanes];
+};
+
+namespace {
+
+using Reduction = WaveformFeatureExtractor::Reduction;
+
+void initLanes(Reduction& r) {
+    for (size_t l = 0; l < kLanes; ++l) {
+        r.sum[l] = 0.0f;
+        r.min_v[l] = std::numeric_limits<float>::infinity();
+        r.max_v[l] = -std::numeric_limits<float>::infinity();
+        r.min_i[l] = 0;
+        r.max_i[l] = 0;
+    }
+}
+
+/// Sample i goes to lane i % 8, exactly as in the vector kernels.
+inline void accumulate(Reduction& r, const float* s, size_t first, size_t last) {
+    for (size_t i = first; i < last; ++i) {
+        const size_t l = i % kLanes;
+        r.sum[l] += s[i];
+        if (s[i] < r.min_v[l]) { r.min_v[l] = s[i]; r.min_i[l] = static_cast<int32_t>(i); }
+        if (s[i] > r.max_v[l]) { r.max_v[l] = s[i]; r.max_i[l] = static_cast<int32_t>(i); }
+    }
+}
+
+void reduceScalar(const float* s, size_t n, Reduction& r) {
+    initLanes(r);
+    accumulate(r, s, 0, n);
+}
+
+#ifdef WAVEFORM_FEATURES_X86
+
+__attribute__((target("sse4.1")))
+void reduceSse41(const float* s, size_t n, Reduction& r) {
+    initLanes(r);
+    __m128 sum[2]  = {_mm_setzero_ps(), _mm_setzero_ps()};
+    __m128 vmin[2] = {_mm_loadu_ps(r.min_v), _mm_loadu_ps(r.min_v + 4)};
+    __m128 vmax[2] = {_mm_loadu_ps(r.max_v), _mm_loadu_ps(r.max_v + 4)};
+    __m128i imin[2] = {_mm_setzero_si128(), _mm_setzero_si128()};
+    __m128i imax[2] = {_mm_setzero_si128(), _mm_setzero_si128()};
+    __m128i idx[2] = {_mm_setr_epi32(0, 1, 2, 3), _mm_setr_epi32(4, 5, 6, 7)};
+    const __m128i step = _mm_set1_epi32(static_cast<int>(kLanes));
+
+    size_t i = 0;
+    for (; i + kLanes <= n; i += kLanes) {
+        for (int h = 0; h < 2; ++h) {
+            const __m128 v = _mm_loadu_ps(s + i + 4 * h);
+            sum[h] = _mm_add_ps(sum[h], v);
+            const __m128 lt = _mm_cmplt_ps(v, vmin[h]);
+            const __m128 gt = _mm_cmpgt_ps(v, vmax[h]);
+            vmin[h] = _mm_blendv_ps(vmin[h], v, lt);
+            vmax[h] = _mm_blendv_ps(vmax[h], v, gt);
+            imin[h] = _mm_blendv_epi8(imin[h], idx[h], _mm_castps_si128(lt));
+            imax[h] = _mm_blendv_epi8(imax[h], idx[h], _mm_castps_si128(gt));
+            idx[h] = _mm_add_epi32(idx[h], step);
+        }
+    }
+
+    for (int h = 0; h < 2; ++h) {
+        _mm_storeu_ps(r.sum + 4 * h, sum[h]);
+        _mm_storeu_ps(r.min_v + 4 * h, vmin[h]);
+        _mm_storeu_ps(r.max_v + 4 * h, vmax[h]);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(r.min_i + 4 * h), imin[h]);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(r.max_i + 4 * h), imax[h]);
+    }
+    accumulate(r, s, i, n);
+}
+
+__attribute__((target("avx2")))
+void reduceAvx2(const float* s, size_t n, Reduction& r) {
+    initLanes(r);
+    __m256 sum  = _mm256_setzero_ps();
+    __m256 vmin = _mm256_loadu_ps(r.min_v);
+    __m256 vmax = _mm256_loadu_ps(r.max_v);
+    __m256i imin = _mm256_setzero_si256();
+    __m256i imax = _mm256_setzero_si256();
+    __m256i idx = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i step = _mm256_set1_epi32(static_cast<int>(kLanes));
+
+    size_t i = 0;
+    for (; i + kLanes <= n; i += kLanes) {
+        const __m256 v = _mm256_loadu_ps(s + i);
+        sum = _mm256_add_ps(sum, v);
+        const __m256 lt = _mm256_cmp_ps(v, vmin, _CMP_LT_OQ);
+        const __m256 gt = _mm256_cmp_ps(v, vmax, _CMP_GT_OQ);
+        vmin = _mm256_blendv_ps(vmin, v, lt);
+        vmax = _mm256_blendv_ps(vmax, v, gt);
+        imin = _mm256_blendv_epi8(imin, idx, _mm256_castps_si256(lt));
+        imax = _mm256_blendv_epi8(imax, idx, _mm256_castps_si256(gt));
+        idx = _mm256_add_epi32(idx, step);
+    }
+
+    _mm256_storeu_ps(r.sum, sum);
+    _mm256_storeu_ps(r.min_v, vmin);
+    _mm256_storeu_ps(r.max_v, vmax);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(r.min_i), imin);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(r.max_i), imax);
+    accumulate(r, s, i, n);
+}
+
+#endif // WAVEFORM_FEATURES_X86
+
+FrontendFeatureKernel resolve(FrontendFeatureKernel requested) {
+    if (requested != FrontendFeatureKernel::AUTO) {
+        if (WaveformFeatureExtractor::supported(requested))
+            return requested;
+        spdlog::warn("WaveformFeatureExtractor: {} kernel not supported by this CPU, using the best available",
+                     WaveformFeatureExtractor::kernelName(requested));
+    }
+    if (WaveformFeatureExtractor::supported(FrontendFeatureKernel::AVX2))
+        return FrontendFeatureKernel::AVX2;
+    if (WaveformFeatureExtractor::supported(FrontendFeatureKernel::SSE41))
+        return FrontendFeatureKernel::SSE41;
+    return FrontendFeatureKernel::SCALAR;
+}
+
+} // namespace
+
+bool WaveformFeatureExtractor::supported(FrontendFeatureKernel k)
+{
+    switch (k) {
+#ifdef WAVEFORM_FEATURES_X86
+        case FrontendFeatureKernel::AVX2:  return __builtin_cpu_supports("avx2");
+        case FrontendFeatureKernel::SSE41: return __builtin_cpu_supports("sse4.1");
+#else
+        case FrontendFeatureKernel::AVX2:
+        case FrontendFeatureKernel::SSE41: return false;
+#endif
+        default: return true;
+    }
+}
+
+const char* WaveformFeatureExtractor::kernelName(FrontendFeatureKernel k)
+{
+    switch (k) {
+        case FrontendFeatureKernel::AUTO:   return "auto";
+        case FrontendFeatureKernel::SCALAR: return "scalar";
+        case FrontendFeatureKernel::SSE41:  return "sse4.1";
+        case FrontendFeatureKernel::AVX2:   return "avx2";
+        default:                            return "unknown";
+    }
+}
+
+WaveformFeatureExtractor::WaveformFeatureExtractor(const FrontendFeatureExtractionConfig& cfg)
+    : kernel_(resolve(cfg.kernel)),
+      reduce_(&reduceScalar),
+      dt_ns_(static_cast<float>(1e3 / std::max(1, cfg.sampling_frequency_mhz))),
+      baseline_samples_(static_cast<size_t>(std::max(1, cfg.baseline_samples))),
+      cfd_fraction_(std::clamp(cfg.cfd_fraction, 0.0f, 1.0f)),
+      polarity_(cfg.negative_pulses ? -1.0f : 1.0f)
+{
+#ifdef WAVEFORM_FEATURES_X86
+    if (kernel_ == FrontendFeatureKernel::AVX2)
+        reduce_ = &reduceAvx2;
+    else if (kernel_ == FrontendFeatureKernel::SSE41)
+        reduce_ = &reduceSse41;
+#endif
+    spdlog::debug("WaveformFeatureExtractor: kernel={}, dt={}ns, baseline_samples={}, cfd_fraction={}",
+                  kernelName(kernel_), dt_ns_, baseline_samples_, cfd_fraction_);
+}
+
+float WaveformFeatureExtractor::crossing(const float* s, size_t peak, float baseline, float level) const
+{
+    // Walk back from the peak to the last sample below the level
+    for (size_t k = peak; k-- > 0;) {
+        const float y0 = polarity_ * (s[k] - baseline);
+        if (y0 < level) {
+            const float y1 = polarity_ * (s[k + 1] - baseline);
+            return static_cast<float>(k) + (level - y0) / (y1 - y0);
+        }
+    }
+    return std::numeric_limits<float>::quiet_NaN();
+}
+
+WaveformFeatures WaveformFeatureExtractor::extract(const float* s, size_t n) const
+{
+    constexpr float kNaN = std::numeric_limits<float>::quiet_NaN();
+    WaveformFeatures f;
+    f.rise_time_ns = kNaN;
+    f.cfd_time_ns = kNaN;
+    if (n == 0)
+        return f;
+
+    Reduction r;
+    reduce_(s, n, r);
+
+    // Fixed reduction order keeps all kernels bit-identical
+    float total = 0.0f;
+    size_t best_min = 0, best_max = 0;
+    for (size_t l = 0; l < kLanes; ++l) {
+        total += r.sum[l];
+        if (r.min_v[l] < r.min_v[best_min] ||
+            (r.min_v[l] == r.min_v[best_min] && r.min_i[l] < r.min_i[best_min]))
+            best_min = l;
+        if (r.max_v[l] > r.max_v[best_max] ||
+            (r.max_v[l] == r.max_v[best_max] && r.max_i[l] < r.max_i[best_max]))
+            best_max = l;
+    }
+
+    const size_t nb = std::min(baseline_samples_, n);
+    float base_sum = 0.0f;
+    for (size_t i = 0; i < nb; ++i)
+        base_sum += s[i];
+    f.baseline = base_sum / static_cast<float>(nb);
+
+    const bool negative = polarity_ < 0.0f;
+    const size_t peak = static_cast<size_t>(negative ? r.min_i[best_min] : r.max_i[best_max]);
+    const float peak_v = negative ? r.min_v[best_min] : r.max_v[best_max];
+
+    f.peak_index = static_cast<uint16_t>(peak);
+    f.amplitude = polarity_ * (peak_v - f.baseline);
+    f.charge = polarity_ * (total - static_cast<float>(n) * f.baseline) * dt_ns_;
+
+    if (f.amplitude > 0.0f) {
+        const float t10 = crossing(s, peak, f.baseline, 0.1f * f.amplitude);
+        const float t90 = crossing(s, peak, f.baseline, 0.9f * f.amplitude);
+        const float tc  = crossing(s, peak, f.baseline, cfd_fraction_ * f.amplitude);
+        f.rise_time_ns = (t90 - t10) * dt_ns_;
+        f.cfd_time_ns = tc * dt_ns_;
+    }
+    return f;
+}
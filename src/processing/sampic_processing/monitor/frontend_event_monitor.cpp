@@ -0,0 +1,100 @@
+#include "processing/sampic_processing/monitor/frontend_event_monitor.h"
+#include "processing/sampic_processing/collector/frontend_event.h"
+
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <bit>
+#include <string>
+
+FrontendEventMonitor::FrontendEventMonitor(FrontendEventBuffer& buffer,
+                                           const FrontendEventMonitorConfig& cfg)
+    : buffer_(buffer), cfg_(cfg)
+{
+    cfg_.interval_ms = std::max<uint32_t>(cfg_.interval_ms, 1);
+}
+
+FrontendEventMonitor::~FrontendEventMonitor() {
+    stop();
+}
+
+void FrontendEventMonitor::start() {
+    if (running_)
+        return;
+
+    events_ = hits_ = bytes_ = 0;
+    board_events_.fill(0);
+    {
+        std::lock_guard<std::mutex> lock(snapshot_mtx_);
+        snapshot_ = FrontendEventMonitorSnapshot{};
+    }
+
+    consumer_ = buffer_.addConsumer("monitor", FrontendEventConsumerPolicy::DROP);
+    running_ = true;
+    thread_ = std::thread(&FrontendEventMonitor::loop, this);
+    spdlog::info("FrontendEventMonitor started (interval={} ms)", cfg_.interval_ms);
+}
+
+void FrontendEventMonitor::stop() {
+    if (!running_)
+        return;
+    running_ = false;
+    if (thread_.joinable())
+        thread_.join();
+    buffer_.removeConsumer(consumer_);
+}
+
+FrontendEventMonitorSnapshot FrontendEventMonitor::snapshot() const {
+    std::lock_guard<std::mutex> lock(snapshot_mtx_);
+    return snapshot_;
+}
+
+void FrontendEventMonitor::loop() {
+    const auto interval = std::chrono::milliseconds(cfg_.interval_ms);
+    const auto wait = std::chrono::microseconds(std::min(interval, std::chrono::milliseconds(100)));
+    auto interval_start = std::chrono::steady_clock::now();
+
+    while (running_) {
+        if (buffer_.waitForConsumer(consumer_, 1, wait)) {
+            for (const auto& ev : buffer_.consume(consumer_)) {
+                if (!ev)
+                    continue;
+                ++events_;
+                hits_ += ev->numHits();
+                bytes_ += ev->totalDataSize();
+                for (uint64_t mask = ev->boardMask(); mask; mask &= mask - 1)
+                    ++board_events_[static_cast<size_t>(std::countr_zero(mask))];
+            }
+        }
+
+        const auto now = std::chrono::steady_clock::now();
+        if (now - interval_start >= interval) {
+            publish(now - interval_start);
+            interval_start = now;
+        }
+    }
+}
+
+void FrontendEventMonitor::publish(std::chrono::steady_clock::duration elapsed) {
+    FrontendEventMonitorSnapshot s;
+    s.interval_s = std::chrono::duration<double>(elapsed).count();
+    s.events_per_s = events_ / s.interval_s;
+    s.hits_per_s = hits_ / s.interval_s;
+    s.mb_per_s = bytes_ / s.interval_s / 1e6;
+    s.board_events = board_events_;
+    s.missed = buffer_.consumerStats(consumer_).missed;
+
+    std::string boards;
+    for (size_t b = 0; b < s.board_events.size(); ++b) {
+        if (s.board_events[b] > 0)
+            boards += (boards.empty() ? "" : " ") + std::to_string(b) + ":" + std::to_string(s.board_events[b]);
+    }
+    spdlog::info("FrontendEventMonitor: {:.1f} events/s, {:.3g} hits/s, {:.2f} MB/s, boards [{}], missed {}",
+                 s.events_per_s, s.hits_per_s, s.mb_per_s, boards, s.missed);
+
+    {
+        std::lock_guard<std::mutex> lock(snapshot_mtx_);
+        snapshot_ = s;
+    }
+    events_ = hits_ = bytes_ = 0;
+    board_events_.fill(0);
+}
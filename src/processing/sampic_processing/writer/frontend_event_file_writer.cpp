@@ -0,0 +1,448 @@
+#include "processing/sampic_processing/writer/frontend_event_file_writer.h"
+#include "processing/sampic_processing/collector/frontend_event.h"
+
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace {
+
+constexpr size_t roundUp(size_t n, size_t align) { return (n + align - 1) / align * align; }
+
+} // namespace
+
+FrontendEventFileWriter::FrontendEventFileWriter(FrontendEventBuffer& buffer,
+                                                 const FrontendEventFileWriterConfig& cfg,
+                                                 int frontend_index)
+    : buffer_(buffer),
+      cfg_(cfg),
+      frontend_index_(frontend_index),
+      buffer_bytes_(roundUp(static_cast<size_t>(std::max<uint32_t>(cfg.buffer_mb, 1)) << 20, kIoAlign)),
+      max_file_bytes_(static_cast<uint64_t>(cfg.max_file_mb) << 20)
+{
+    std::snprintf(bank_suffix_, sizeof(bank_suffix_), "%02d", frontend_index_ % 100);
+
+    buffers_.resize(std::max<uint32_t>(cfg_.num_buffers, 2));
+    for (auto& buf : buffers_) {
+        buf.data = static_cast<uint8_t*>(std::aligned_alloc(kIoAlign, buffer_bytes_));
+        if (!buf.data)
+            throw std::bad_alloc();
+        buf.capacity = buffer_bytes_;
+    }
+
+    spdlog::info("FrontendEventFileWriter initialized (directory={}, buffers={}x{} MB, "
+                 "max_file_mb={}, direct_io={})",
+                 cfg_.directory, buffers_.size(), buffer_bytes_ >> 20,
+                 cfg_.max_file_mb, cfg_.direct_io);
+}
+
+FrontendEventFileWriter::~FrontendEventFileWriter() {
+    stop();
+    for (auto& buf : buffers_)
+        std::free(buf.data);
+}
+
+std::string FrontendEventFileWriter::basePath(int run_number, uint32_t seq) const {
+    char name[128];
+    std::snprintf(name, sizeof(name), "_fe%02d_run%06d_%04u", frontend_index_, run_number, seq);
+    return cfg_.directory + "/" + cfg_.file_prefix + name;
+}
+
+std::string FrontendEventFileWriter::filePath(int run_number, uint32_t seq) const {
+    return basePath(run_number, seq) + ".sfe";
+}
+
+std::string FrontendEventFileWriter::indexPath(int run_number, uint32_t seq) const {
+    return basePath(run_number, seq) + ".sfi";
+}
+
+// ------------------------------------------------------------------
+// Control
+// ------------------------------------------------------------------
+
+bool FrontendEventFileWriter::start(int run_number) {
+    if (running_)
+        return true;
+
+    run_number_ = run_number;
+    file_bytes_ = 0;
+    file_seq_ = 0;
+    io_file_seq_ = 0;
+    event_seq_ = 0;
+    events_ = bytes_ = files_ = buffer_waits_ = write_errors_ = index_errors_ = 0;
+
+    free_.clear();
+    for (auto& buf : buffers_)
+        free_.push_back(&buf);
+    filled_.clear();
+    io_done_ = false;
+
+    // Open the first file here so a bad directory fails the run start
+    if (!openFile(0)) {
+        spdlog::error("FrontendEventFileWriter: cannot open {}: {}",
+                      filePath(run_number_, 0), std::strerror(errno));
+        return false;
+    }
+    openIndex(0);
+    appendFileHeader();
+
+    consumer_ = buffer_.addConsumer("file_writer", FrontendEventConsumerPolicy::BLOCK);
+    running_ = true;
+    io_ = std::thread(&FrontendEventFileWriter::ioLoop, this);
+    serializer_ = std::thread(&FrontendEventFileWriter::serializeLoop, this);
+    return true;
+}
+
+void FrontendEventFileWriter::stop() {
+    if (!running_) {
+        closeFile();
+        closeIndex();
+        return;
+    }
+    running_ = false;
+    if (serializer_.joinable())
+        serializer_.join();
+    if (io_.joinable())
+        io_.join();
+    buffer_.removeConsumer(consumer_);
+
+    const FrontendEventFileWriterStats s = stats();
+    spdlog::info("FrontendEventFileWriter stopped (events={}, {:.1f} MB in {} file(s), "
+                 "buffer_waits={}, write_errors={}, index_errors={})",
+                 s.events, s.bytes / 1e6, s.files, s.buffer_waits, s.write_errors, s.index_errors);
+}
+
+FrontendEventFileWriterStats FrontendEventFileWriter::stats() const {
+    FrontendEventFileWriterStats s;
+    s.events       = events_.load(std::memory_order_relaxed);
+    s.bytes        = bytes_.load(std::memory_order_relaxed);
+    s.files        = files_.load(std::memory_order_relaxed);
+    s.buffer_waits = buffer_waits_.load(std::memory_order_relaxed);
+    s.write_errors = write_errors_.load(std::memory_order_relaxed);
+    s.index_errors = index_errors_.load(std::memory_order_relaxed);
+    return s;
+}
+
+// ------------------------------------------------------------------
+// Serializer thread
+// ------------------------------------------------------------------
+
+void FrontendEventFileWriter::serializeLoop() {
+    const auto flush_after = std::chrono::milliseconds(cfg_.flush_interval_ms);
+    const auto wait = std::chrono::milliseconds(std::clamp<uint32_t>(cfg_.flush_interval_ms, 1, 100));
+
+    while (running_) {
+        if (buffer_.waitForConsumer(consumer_, 1, wait))
+            drain();
+
+        if (current_ && cfg_.flush_interval_ms > 0 &&
+            std::chrono::steady_clock::now() - current_since_ >= flush_after)
+            submitCurrent(false);
+    }
+
+    // Events pushed before the collector stopped still belong to this run
+    drain();
+    if (current_)
+        submitCurrent(true);
+    closeIndex();
+
+    std::lock_guard<std::mutex> lock(mtx_);
+    io_done_ = true;
+    filled_cv_.notify_all();
+}
+
+void FrontendEventFileWriter::drain() {
+    for (const auto& ev : buffer_.consume(consumer_)) {
+        if (ev)
+            appendEvent(*ev);
+    }
+}
+
+void FrontendEventFileWriter::appendFileHeader() {
+    Format::FileHeader fh{};
+    fh.frame.magic    = Format::kFileMagic;
+    fh.frame.size     = static_cast<uint32_t>(Format::padded(sizeof(fh)));
+    fh.version        = Format::kVersion;
+    fh.frontend_index = static_cast<uint32_t>(frontend_index_);
+    fh.run_number     = run_number_;
+    fh.file_sequence  = file_seq_;
+    fh.created_unix_ns = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count());
+
+    uint8_t* p = reserve(fh.frame.size);
+    std::memset(p, 0, fh.frame.size);
+    std::memcpy(p, &fh, sizeof(fh));
+}
+
+void FrontendEventFileWriter::appendEvent(const FrontendEvent& fev) {
+    size_t frame = sizeof(Format::EventHeader);
+    for (const auto& bank : fev.banks())
+        frame += sizeof(Format::BankHeader) + Format::padded(bank->size());
+    if (frame > UINT32_MAX) {
+        spdlog::error("FrontendEventFileWriter: FrontendEvent of {} B exceeds the frame limit, skipped", frame);
+        return;
+    }
+
+    uint8_t* p = reserve(frame);
+    const uint64_t offset = file_bytes_ - frame;
+
+    Format::EventHeader eh{};
+    eh.frame.magic   = Format::kEventMagic;
+    eh.frame.size    = static_cast<uint32_t>(frame);
+    eh.sequence      = event_seq_++;
+    eh.timestamp_ns  = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            fev.timestamp().time_since_epoch()).count());
+    eh.n_hits        = static_cast<uint32_t>(fev.numHits());
+    eh.n_banks       = static_cast<uint32_t>(fev.numBanks());
+    std::memcpy(p, &eh, sizeof(eh));
+    p += sizeof(eh);
+    if (index_)
+        appendIndexEntry(eh, offset, fev);
+
+    for (const auto& bank : fev.banks()) {
+        const std::string& prefix = bank->bankPrefix();
+        const bool ok = prefix.size() >= 2;
+        const size_t len = bank->size();
+
+        Format::BankHeader bh{};
+        bh.name[0]   = ok ? prefix[0] : 'X';
+        bh.name[1]   = ok ? prefix[1] : 'X';
+        bh.name[2]   = bank_suffix_[0];
+        bh.name[3]   = bank_suffix_[1];
+        bh.data_size = static_cast<uint32_t>(len);
+        std::memcpy(p, &bh, sizeof(bh));
+        p += sizeof(bh);
+
+        bank->serializeInto(p, len);
+        std::memset(p + len, 0, Format::padded(len) - len);
+        p += Format::padded(len);
+    }
+    events_.fetch_add(1, std::memory_order_relaxed);
+
+    if (max_file_bytes_ > 0 && file_bytes_ >= max_file_bytes_) {
+        submitCurrent(true);
+        ++file_seq_;
+        file_bytes_ = 0;
+        closeIndex();
+        openIndex(file_seq_);
+        appendFileHeader();
+    }
+}
+
+uint8_t* FrontendEventFileWriter::reserve(size_t n) {
+    if (current_ && current_->capacity - current_->used < n)
+        submitCurrent(false);
+
+    if (!current_) {
+        if (n > buffer_bytes_) {
+            // A single event larger than a buffer gets a one-off buffer of its own
+            const size_t cap = roundUp(n, kIoAlign);
+            auto* data = static_cast<uint8_t*>(std::aligned_alloc(kIoAlign, cap));
+            if (!data)
+                throw std::bad_alloc();
+            current_ = new WriteBuffer{data, cap, 0, false, true};
+        } else {
+            current_ = takeFreeBuffer();
+        }
+        current_since_ = std::chrono::steady_clock::now();
+    }
+
+    uint8_t* p = current_->data + current_->used;
+    current_->used += n;
+    file_bytes_ += n;
+    return p;
+}
+
+void FrontendEventFileWriter::submitCurrent(bool close_file) {
+    // Frames are 8-byte aligned, so the gap is either empty or fits a pad frame
+    const size_t aligned = roundUp(current_->used, kIoAlign);
+    if (aligned > current_->used) {
+        uint8_t* p = current_->data + current_->used;
+        const Format::FrameHeader pad{Format::kPadMagic, static_cast<uint32_t>(aligned - current_->used)};
+        std::memset(p, 0, pad.size);
+        std::memcpy(p, &pad, sizeof(pad));
+        file_bytes_ += pad.size;
+        current_->used = aligned;
+    }
+    current_->close_file = close_file;
+
+    // Keep the index on disk roughly in step with the data
+    if (index_ && std::fflush(index_) != 0)
+        indexError();
+
+    std::lock_guard<std::mutex> lock(mtx_);
+    filled_.push_back(current_);
+    current_ = nullptr;
+    filled_cv_.notify_one();
+}
+
+FrontendEventFileWriter::WriteBuffer* FrontendEventFileWriter::takeFreeBuffer() {
+    std::unique_lock<std::mutex> lock(mtx_);
+    if (free_.empty()) {
+        buffer_waits_.fetch_add(1, std::memory_order_relaxed);
+        free_cv_.wait(lock, [&] { return !free_.empty(); });
+    }
+    WriteBuffer* buf = free_.back();
+    free_.pop_back();
+    buf->used = 0;
+    buf->close_file = false;
+    return buf;
+}
+
+void FrontendEventFileWriter::releaseBuffer(WriteBuffer* buf) {
+    if (buf->oversize) {
+        std::free(buf->data);
+        delete buf;
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mtx_);
+    free_.push_back(buf);
+    free_cv_.notify_one();
+}
+
+// ------------------------------------------------------------------
+// Index (serializer thread)
+// ------------------------------------------------------------------
+
+void FrontendEventFileWriter::openIndex(uint32_t seq) {
+    if (!cfg_.write_index)
+        return;
+
+    const std::string path = indexPath(run_number_, seq);
+    index_ = std::fopen(path.c_str(), "wb");
+    if (!index_) {
+        spdlog::warn("FrontendEventFileWriter: cannot create index {}: {}", path, std::strerror(errno));
+        index_errors_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    Format::IndexHeader ih{};
+    ih.frame.magic    = Format::kIndexMagic;
+    ih.frame.size     = sizeof(ih);
+    ih.version        = Format::kVersion;
+    ih.frontend_index = static_cast<uint32_t>(frontend_index_);
+    ih.run_number     = run_number_;
+    ih.file_sequence  = seq;
+    ih.entry_size     = sizeof(Format::IndexEntry);
+    if (std::fwrite(&ih, sizeof(ih), 1, index_) != 1)
+        indexError();
+}
+
+void FrontendEventFileWriter::closeIndex() {
+    if (index_) {
+        if (std::fclose(index_) != 0)
+            indexError();
+        index_ = nullptr;
+    }
+}
+
+void FrontendEventFileWriter::appendIndexEntry(const Format::EventHeader& eh, uint64_t offset,
+                                               const FrontendEvent& fev) {
+    Format::IndexEntry e{};
+    e.offset       = offset;
+    e.sequence     = eh.sequence;
+    e.timestamp_ns = eh.timestamp_ns;
+    e.first_hit_ts = fev.firstHitTimestamp();
+    e.last_hit_ts  = fev.lastHitTimestamp();
+    e.board_mask   = fev.boardMask();
+    e.n_hits       = eh.n_hits;
+    e.frame_size   = eh.frame.size;
+    if (std::fwrite(&e, sizeof(e), 1, index_) != 1)
+        indexError();
+}
+
+void FrontendEventFileWriter::indexError() {
+    const uint64_t n = index_errors_.fetch_add(1, std::memory_order_relaxed) + 1;
+    if ((n & (n - 1)) == 0) // log at powers of two to avoid flooding
+        spdlog::error("FrontendEventFileWriter: index write failed ({} error(s) so far)", n);
+}
+
+// ------------------------------------------------------------------
+// I/O thread
+// ------------------------------------------------------------------
+
+void FrontendEventFileWriter::ioLoop() {
+    for (;;) {
+        WriteBuffer* buf = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(mtx_);
+            filled_cv_.wait(lock, [&] { return !filled_.empty() || io_done_; });
+            if (filled_.empty())
+                break;
+            buf = filled_.front();
+            filled_.pop_front();
+        }
+
+        const bool ok = (fd_ >= 0 || openFile(io_file_seq_)) && writeAll(buf->data, buf->used);
+        if (ok) {
+            bytes_.fetch_add(buf->used, std::memory_order_relaxed);
+        } else {
+            const uint64_t n = write_errors_.fetch_add(1, std::memory_order_relaxed) + 1;
+            if ((n & (n - 1)) == 0) // log at powers of two to avoid flooding
+                spdlog::error("FrontendEventFileWriter: writing {} failed: {} ({} buffer(s) lost so far)",
+                              filePath(run_number_, io_file_seq_), std::strerror(errno), n);
+        }
+
+        if (buf->close_file) {
+            closeFile();
+            ++io_file_seq_;
+        }
+        releaseBuffer(buf);
+    }
+    closeFile();
+}
+
+bool FrontendEventFileWriter::openFile(uint32_t seq) {
+    const std::string path = filePath(run_number_, seq);
+    const int flags = O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC;
+
+    fd_ = -1;
+#ifdef O_DIRECT
+    if (cfg_.direct_io) {
+        fd_ = ::open(path.c_str(), flags | O_DIRECT, 0644);
+        if (fd_ < 0 && errno == EINVAL && !warned_no_direct_) {
+            warned_no_direct_ = true;
+            spdlog::warn("FrontendEventFileWriter: {} does not support O_DIRECT, using buffered I/O",
+                         cfg_.directory);
+        }
+    }
+#endif
+    if (fd_ < 0)
+        fd_ = ::open(path.c_str(), flags, 0644);
+    if (fd_ < 0)
+        return false;
+
+    files_.fetch_add(1, std::memory_order_relaxed);
+    spdlog::info("FrontendEventFileWriter: writing {}", path);
+    return true;
+}
+
+void FrontendEventFileWriter::closeFile() {
+    if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+}
+
+bool FrontendEventFileWriter::writeAll(const uint8_t* data, size_t len) {
+    while (len > 0) {
+        const ssize_t n = ::write(fd_, data, len);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+        data += n;
+        len -= static_cast<size_t>(n);
+    }
+    return true;
+}